@@ -1,16 +1,115 @@
 #!/usr/bin/env python3
-""" print_image """
+""" Converts PNG images to constexpr arrays for Image8880 """
 
 import argparse
+import re
+import struct
+import zlib
 
-from PIL import Image
-from numpy import asarray
 from pathlib import Path
 
 # ================================================================================
 
-def hex_fill(value, length):
-    return '0x' + hex(value)[2:].zfill(length)
+def paeth(a, b, c):
+    p = a + b - c
+    pa = abs(p - a)
+    pb = abs(p - b)
+    pc = abs(p - c)
+
+    if pa <= pb and pa <= pc:
+        return a
+    if pb <= pc:
+        return b
+    return c
+
+# ================================================================================
+
+def read_png(name):
+    """Returns the width, height and rows of (r, g, b) pixels of a PNG."""
+
+    data = Path(name).read_bytes()
+
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        raise ValueError(f'{name} is not a PNG')
+
+    offset = 8
+    idat = b''
+    palette = []
+
+    while offset < len(data):
+        length, kind = struct.unpack('>I4s', data[offset:offset + 8])
+        body = data[offset + 8:offset + 8 + length]
+        offset += length + 12
+
+        if kind == b'IHDR':
+            width, height, depth, colour, _, _, interlace = struct.unpack('>IIBBBBB', body)
+        elif kind == b'PLTE':
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif kind == b'IDAT':
+            idat += body
+        elif kind == b'IEND':
+            break
+
+    if interlace != 0:
+        raise ValueError(f'{name} is interlaced')
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[colour]
+    bits = channels * depth
+    stride = (width * bits + 7) // 8
+    step = max(1, bits // 8)
+
+    raw = zlib.decompress(idat)
+    previous = bytearray(stride)
+    rows = []
+
+    for y in range(height):
+        start = y * (stride + 1)
+        kind = raw[start]
+        line = bytearray(raw[start + 1:start + 1 + stride])
+
+        for i in range(stride):
+            a = line[i - step] if i >= step else 0
+            b = previous[i]
+            c = previous[i - step] if i >= step else 0
+
+            if kind == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif kind == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif kind == 3:
+                line[i] = (line[i] + ((a + b) // 2)) & 0xFF
+            elif kind == 4:
+                line[i] = (line[i] + paeth(a, b, c)) & 0xFF
+
+        previous = line
+
+        # Samples are packed into bytes below 8 bits, and only the high
+        # byte of 16 bit samples is used.
+
+        if depth < 8:
+            mask = (1 << depth) - 1
+            samples = [(line[(x * depth) // 8] >> (8 - depth - ((x * depth) % 8))) & mask
+                       for x in range(width * channels)]
+        else:
+            samples = list(line[::depth // 8])
+
+        if colour == 3:
+            pixels = [palette[s] for s in samples]
+        else:
+            scale = 255 // ((1 << min(depth, 8)) - 1)
+            pixels = []
+
+            for x in range(width):
+                s = samples[x * channels:(x + 1) * channels]
+
+                if colour in (0, 4):
+                    pixels.append((s[0] * scale,) * 3)
+                else:
+                    pixels.append(tuple(s[:3]))
+
+        rows.append(pixels)
+
+    return width, height, rows
 
 # ================================================================================
 
@@ -20,52 +119,60 @@ def main():
     # ----------------------------------------------------------------------------
 
     parser = argparse.ArgumentParser()
-    parser.add_argument('name', help='image file name')
+    parser.add_argument('-o', '--output', required=True, help='header to write')
+    parser.add_argument('names', nargs='+', help='image file names')
     args = parser.parse_args()
 
     # ----------------------------------------------------------------------------
 
-    image = Image.open(args.name)
+    # Files named <name>_<n>.png are the frames of one image.
+
+    images = {}
+
+    for name in args.names:
+        match = re.fullmatch(r'(.*?)(?:_(\d+))?', Path(name).stem)
+        frame = int(match.group(2) or 0)
+        images.setdefault(match.group(1), []).append((frame, name))
 
-    image_rgba = image.convert('RGBA')
-    data = asarray(image_rgba)
+    lines = [f'// Generated by {Path(__file__).name}. Do not edit.',
+             '',
+             '#pragma once',
+             '',
+             '#include <array>',
+             '#include <cstdint>']
 
-    name_stem = Path(args.name).stem
-    name = f"{name_stem}Image"
-    length = image.width * image.height
-    print(f"std::vector<uint32_t> {name} = ")
-    print("{", end='')
+    for stem, frames in sorted(images.items()):
+        values = []
+        size = None
 
-    codeWidth = 10
-    #codeWidth = image.width
+        for _, name in sorted(frames):
+            width, height, rows = read_png(name)
 
-    #while codeWidth > 16:
-    #    codeWidth = codeWidth // 2
+            if size not in (None, (width, height)):
+                raise ValueError(f'{name} is not the size of the other frames')
 
-    index = 0
+            size = (width, height)
 
-    for i in range(image.width):
-        x = image.width - 1 - i
-        for j in range(image.height):
+            # Columns from right to left, as Image8880 stores them.
 
-            if ((index % codeWidth) == 0):
-                print("")
-                print("    ", end='')
-            index += 1
-            y = j
-            pixel = data[y][x]
+            for x in reversed(range(width)):
+                for y in range(height):
+                    r, g, b = rows[y][x]
+                    values.append((r << 16) | (g << 8) | b)
 
-            r = pixel[0]
-            g = pixel[1]
-            b = pixel[2]
-            a = pixel[3]
+        lines.append('')
+        plural = 's' if len(frames) > 1 else ''
+        lines.append(f'// {size[0]}x{size[1]}, {len(frames)} frame{plural}')
+        lines.append('')
+        lines.append(f'inline constexpr std::array<uint32_t, {len(values)}> {stem}Image')
+        lines.append('{')
 
-            value = b | (g << 8) | (r << 16)
+        for i in range(0, len(values), 10):
+            lines.append('    ' + ' '.join(f'0x{v:08x},' for v in values[i:i + 10]))
 
-            print(hex_fill(value, 8) + ", ", end='')
+        lines.append('};')
 
-    print("")
-    print("};")
+    Path(args.output).write_text('\n'.join(lines) + '\n')
 
 # ================================================================================
 
@@ -1,744 +0,0 @@
-std::vector<uint32_t> emptyImage = 
-{
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-};
-std::vector<uint32_t> passageImage = 
-{
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x0000ffff, 
-    0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 
-    0x0000ffff, 0x0000ffff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x0000ffff, 
-    0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 
-    0x0000ffff, 0x0000ffff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-};
-std::vector<uint32_t> boxImage = 
-{
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 0x00008000, 0x00000000, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00000000, 0x00008000, 0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 
-    0x00008000, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 
-    0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 
-    0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00008000, 
-    0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 0x00008000, 0x00000000, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00000000, 0x00008000, 0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-};
-std::vector<uint32_t> player_0Image = 
-{
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x00ffffff, 0x00ffffff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ffffff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00c0c0c0, 0x00000000, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00000000, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00808080, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00808080, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00808080, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00ff00ff, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00000000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00000000, 0x00ffffff, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00800000, 0x00800000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x0000ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00800000, 0x00800000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00808080, 0x00808080, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00808080, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00800000, 0x00800000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00808080, 0x00808080, 0x00808080, 
-    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00800000, 0x00800000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00808080, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00808080, 0x00808080, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00800000, 0x00000000, 
-    0x00ffffff, 0x00ffffff, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00000000, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00ff0000, 0x00ff0000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x00000000, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00000000, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 
-    0x00ffffff, 0x00ffffff, 0x00ff0000, 0x00ff0000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00ff00ff, 0x00ffffff, 0x00ff0000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00ff00ff, 0x00000000, 0x00ff0000, 0x00000000, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00808080, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00ff00ff, 0x00000000, 0x00ff0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00808080, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x00000000, 0x000000ff, 0x00000000, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x000000ff, 
-    0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x000000ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00ff0000, 
-    0x00ff0000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-};
-std::vector<uint32_t> wallImage = 
-{
-    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 
-    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 
-    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 
-    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 
-    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-};
-std::vector<uint32_t> passageWithTargetImage = 
-{
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x0000ffff, 
-    0x0000ffff, 0x0000ffff, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffffff, 0x00ffffff, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x0000ff00, 0x00ffff00, 
-    0x00808000, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00ffff00, 0x00ffff00, 
-    0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x0000ff00, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00ffff00, 0x00ffff00, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x0000ff00, 
-    0x00808000, 0x00808000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00ffff00, 0x00ffff00, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x0000ff00, 0x0000ff00, 
-    0x0000ff00, 0x00808000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00808000, 
-    0x0000ff00, 0x00808000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffffff, 0x00ffffff, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x0000ff00, 0x00ffff00, 0x0000ff00, 
-    0x0000ff00, 0x00808000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x0000ff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x0000ff00, 0x00ffff00, 0x0000ff00, 0x00808000, 
-    0x0000ff00, 0x00808000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00ffff00, 0x0000ff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x0000ff00, 0x00ffff00, 0x0000ff00, 
-    0x00808000, 0x00808000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ff00, 0x0000ff00, 
-    0x0000ff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x0000ff00, 0x0000ff00, 0x00ffff00, 0x00808000, 0x0000ff00, 
-    0x00808000, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ff00, 0x0000ff00, 
-    0x0000ff00, 0x0000ff00, 0x0000ff00, 0x00ffff00, 0x0000ff00, 0x0000ff00, 0x00808000, 0x0000ff00, 0x0000ff00, 0x00808000, 
-    0x00808000, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x0000ff00, 
-    0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x00808000, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x00808000, 0x00808000, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x0000ffff, 
-    0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x00808000, 0x00808000, 0x00808000, 0x00808000, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00808000, 0x00808000, 0x00808000, 0x00808000, 0x00808000, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 
-    0x0000ffff, 0x0000ffff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-};
-std::vector<uint32_t> boxOnTargetImage = 
-{
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00000000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00000000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00000000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00000000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 0x00800000, 0x00000000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00000000, 0x00800000, 0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 0x00800000, 0x00800000, 0x00000000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00000000, 0x00800000, 0x00800000, 0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 
-    0x00800000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 
-    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 
-    0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00800000, 
-    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 0x00800000, 0x00800000, 0x00000000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00000000, 0x00800000, 0x00800000, 0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 0x00800000, 0x00000000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00000000, 0x00800000, 0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00000000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00000000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00000000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00000000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-};
-std::vector<uint32_t> playerOnTarget_0Image = 
-{
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x00ffffff, 0x00ffffff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ffffff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00c0c0c0, 0x00000000, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00000000, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00808080, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x009f9f5f, 0x00ffff41, 
-    0x00ffff00, 0x00ffff41, 0x009f9f5f, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00ff00ff, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffff61, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff61, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffff20, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff20, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00000000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffff20, 0x00ffff00, 
-    0x00ffff00, 0x00404000, 0x00ffff20, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00800000, 0x00800000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x0000ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffff61, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff61, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00800000, 0x00800000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00808080, 0x009f9f5f, 0x00ffff41, 
-    0x00ffff00, 0x00ffff41, 0x009f9f5f, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00800000, 0x00800000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00808080, 0x00808080, 0x00808080, 
-    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00800000, 0x00800000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x009f9f5f, 0x00ffff41, 0x00ffff00, 
-    0x00ffff41, 0x009f9f5f, 0x00808080, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00800000, 0x00000000, 
-    0x00ffffff, 0x00ffffff, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffff61, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff61, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00000000, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00ff0000, 0x00ff0000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x00000000, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00ffff20, 0x00404000, 0x00ffff00, 
-    0x00ffff00, 0x00ffff20, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 
-    0x00ffffff, 0x00ffffff, 0x00ff0000, 0x00ff0000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffff20, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff20, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00ff00ff, 0x00ffffff, 0x00ff0000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffff61, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff61, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00ff00ff, 0x00000000, 0x00ff0000, 0x00000000, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00404000, 0x00ffff41, 0x00ffff00, 
-    0x00ffff41, 0x009f9f5f, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00ff00ff, 0x00000000, 0x00ff0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00808080, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x00000000, 0x000000ff, 0x00000000, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x000000ff, 
-    0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x000000ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00ff0000, 
-    0x00ff0000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-};
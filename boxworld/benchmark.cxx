@@ -0,0 +1,305 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <getopt.h>
+#include <libgen.h>
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "boxworld.h"
+#include "levels.h"
+#include "solver.h"
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+
+//-------------------------------------------------------------------------
+
+void
+printUsage(
+    std::ostream& os,
+    const std::string& name)
+{
+    os << "\n";
+    os << "Usage: " << name << " <options>\n";
+    os << "\n";
+    os << "    --help,-h - print usage and exit\n";
+    os << "    --level,-l <number> - only solve this level\n";
+    os << "    --levels,-f <file> - solve the levels in a Sokoban level pack\n";
+    os << "    --nodes,-n <count> - maximum positions stored per level";
+    os << " (default is " << Solver::defaultMaxNodes << ")\n";
+    os << "\n";
+}
+
+//-------------------------------------------------------------------------
+
+// Play the moves on the board and check that every box ends up on a
+// target, so a broken solution can't be reported as solved.
+
+bool
+replay(
+    Level::LevelType board,
+    const std::string& moves)
+{
+    int x = 0;
+    int y = 0;
+
+    for (int j = 0 ; j < Level::levelHeight ; ++j)
+    {
+        for (int i = 0 ; i < Level::levelWidth ; ++i)
+        {
+            if ((board[j][i] & ~Boxworld::targetMask) == Boxworld::PLAYER)
+            {
+                x = i;
+                y = j;
+            }
+        }
+    }
+
+    auto move = [&board](int fromX, int fromY, int toX, int toY)
+    {
+        auto& from = board[fromY][fromX];
+        auto& to = board[toY][toX];
+
+        to = (to & Boxworld::targetMask) | (from & ~Boxworld::targetMask);
+        from = (from & Boxworld::targetMask) | Boxworld::PASSAGE;
+    };
+
+    for (const char step : moves)
+    {
+        int dx = 0;
+        int dy = 0;
+
+        switch (std::tolower(step))
+        {
+        case 'u': dy = -1; break;
+        case 'd': dy = 1; break;
+        case 'l': dx = -1; break;
+        case 'r': dx = 1; break;
+        default: return false;
+        }
+
+        const int piece = board[y + dy][x + dx] & ~Boxworld::targetMask;
+        const bool push = std::isupper(step);
+
+        if (push)
+        {
+            const auto beyond = board[y + 2 * dy][x + 2 * dx] & ~Boxworld::targetMask;
+
+            if ((piece != Boxworld::BOX) or (beyond != Boxworld::PASSAGE))
+            {
+                return false;
+            }
+
+            move(x + dx, y + dy, x + 2 * dx, y + 2 * dy);
+        }
+        else if (piece != Boxworld::PASSAGE)
+        {
+            return false;
+        }
+
+        move(x, y, x + dx, y + dy);
+        x += dx;
+        y += dy;
+    }
+
+    for (const auto& row : board)
+    {
+        for (const auto piece : row)
+        {
+            if (piece == Boxworld::BOX)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+//-------------------------------------------------------------------------
+
+}
+
+//-------------------------------------------------------------------------
+
+int
+main(
+    int argc,
+    char *argv[])
+{
+    size_t maxNodes = Solver::defaultMaxNodes;
+    int only = 0;
+    std::string packFile;
+    char* program = basename(argv[0]);
+
+    //---------------------------------------------------------------------
+
+    static const char* sopts = "f:hl:n:";
+    static struct option lopts[] =
+    {
+        { "help", no_argument, nullptr, 'h' },
+        { "level", required_argument, nullptr, 'l' },
+        { "levels", required_argument, nullptr, 'f' },
+        { "nodes", required_argument, nullptr, 'n' },
+        { nullptr, no_argument, nullptr, 0 }
+    };
+
+    int opt = 0;
+
+    while ((opt = getopt_long(argc, argv, sopts, lopts, nullptr)) != -1)
+    {
+        switch (opt)
+        {
+        case 'f':
+
+            packFile = optarg;
+
+            break;
+
+        case 'h':
+
+            printUsage(std::cout, program);
+            ::exit(EXIT_SUCCESS);
+
+            break;
+
+        case 'l':
+
+            only = std::max(1, std::atoi(optarg));
+
+            break;
+
+        case 'n':
+
+            maxNodes = std::max(1, std::atoi(optarg));
+
+            break;
+
+        default:
+
+            printUsage(std::cerr, program);
+            ::exit(EXIT_FAILURE);
+
+            break;
+        }
+    }
+
+    //---------------------------------------------------------------------
+
+    std::unique_ptr<const Levels> levels;
+
+    try
+    {
+        levels = std::make_unique<const Levels>(packFile);
+    }
+    catch (std::exception& error)
+    {
+        std::cerr << "Error: " << error.what() << "\n";
+        ::exit(EXIT_FAILURE);
+    }
+
+    int first = 0;
+    int last = levels->count() - 1;
+
+    if (only > 0)
+    {
+        first = std::min(only, levels->count()) - 1;
+        last = first;
+    }
+
+    int solved = 0;
+    int exhausted = 0;
+    int failed = 0;
+    uint64_t totalNodes = 0;
+    double totalSeconds = 0.0;
+
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "level  pushes  moves      nodes   seconds    nodes/s  result\n";
+
+    for (int level = first ; level <= last ; ++level)
+    {
+        const auto board = levels->level(level);
+
+        const auto start = std::chrono::steady_clock::now();
+        Solver solver{board, maxNodes};
+        const auto result = solver.solve();
+        const std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - start;
+
+        totalNodes += result.nodes;
+        totalSeconds += elapsed.count();
+
+        std::string status = "unsolved";
+
+        if (result.exhausted)
+        {
+            status = "node limit";
+            ++exhausted;
+        }
+        else if (result.solved)
+        {
+            if (replay(board, result.moves))
+            {
+                status = "solved";
+                ++solved;
+            }
+            else
+            {
+                status = "INVALID";
+                ++failed;
+            }
+        }
+
+        std::cout << std::setw(5) << (level + 1)
+                  << std::setw(8) << result.pushes
+                  << std::setw(7) << result.moves.size()
+                  << std::setw(11) << result.nodes
+                  << std::setw(10) << elapsed.count()
+                  << std::setw(11) << static_cast<uint64_t>(result.nodes / elapsed.count())
+                  << "  " << status << "\n";
+    }
+
+    std::cout << "\nsolved " << solved << " of " << (last - first + 1)
+              << " levels, " << exhausted << " stopped at the node limit, "
+              << totalNodes << " nodes in "
+              << totalSeconds << " seconds, "
+              << static_cast<uint64_t>(totalNodes / totalSeconds)
+              << " nodes/s\n";
+
+    return (failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
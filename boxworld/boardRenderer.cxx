@@ -0,0 +1,222 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <algorithm>
+
+#include "boardRenderer.h"
+#include "boxworld.h"
+
+//-------------------------------------------------------------------------
+
+using namespace ogsfb32;
+
+//-------------------------------------------------------------------------
+
+BoardRenderer::BoardRenderer()
+:
+    m_static{ tileWidth * Level::levelWidth, tileHeight * Level::levelHeight },
+    m_staticBoard{},
+    m_drawn{},
+    m_valid{false}
+{
+}
+
+//-------------------------------------------------------------------------
+
+bool
+BoardRenderer::draw(
+    FrameBuffer8880& fb,
+    const FB8880Point& origin,
+    const Level::LevelType& board,
+    const Tiles& tiles)
+{
+    Level::LevelType staticBoard;
+
+    for (int j = 0 ; j < Level::levelHeight ; ++j)
+    {
+        for (int i = 0 ; i < Level::levelWidth ; ++i)
+        {
+            staticBoard[j][i] = staticPiece(board[j][i]);
+        }
+    }
+
+    // A new level draws the whole of the new static layer, after which
+    // the boxes and the player are drawn over it as changed squares.
+
+    const bool full = not m_valid or (staticBoard != m_staticBoard);
+
+    if (full)
+    {
+        m_staticBoard = staticBoard;
+        renderStatic(tiles);
+        fb.putImage(origin, m_static);
+        fb.addDamage(origin, m_static.getWidth(), m_static.getHeight());
+        m_drawn = m_staticBoard;
+        m_valid = true;
+    }
+
+    for (int j = 0 ; j < Level::levelHeight ; ++j)
+    {
+        for (int i = 0 ; i < Level::levelWidth ; ++i)
+        {
+            const auto piece = board[j][i];
+
+            if (piece == m_drawn[j][i])
+            {
+                continue;
+            }
+
+            if (piece == m_staticBoard[j][i])
+            {
+                restore(fb,
+                        origin,
+                        i * tileWidth,
+                        j * tileHeight,
+                        tileWidth,
+                        tileHeight);
+            }
+            else
+            {
+                const FB8880Point p{
+                    (i * tileWidth) + origin.x(),
+                    (j * tileHeight) + origin.y()
+                };
+
+                fb.putImage(p, tiles[piece]);
+                fb.addDamage(p, tileWidth, tileHeight);
+            }
+
+            m_drawn[j][i] = piece;
+        }
+    }
+
+    return full;
+}
+
+//-------------------------------------------------------------------------
+
+uint8_t
+BoardRenderer::staticPiece(
+    uint8_t piece)
+{
+    switch (piece)
+    {
+    case Boxworld::EMPTY:
+    case Boxworld::WALL:
+
+        return piece;
+
+    default:
+
+        return (piece & Boxworld::targetMask)
+             ? Boxworld::PASSAGE_WITH_TARGET
+             : Boxworld::PASSAGE;
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+BoardRenderer::renderStatic(
+    const Tiles& tiles)
+{
+    for (int j = 0 ; j < Level::levelHeight ; ++j)
+    {
+        for (int i = 0 ; i < Level::levelWidth ; ++i)
+        {
+            const auto& tile = tiles[m_staticBoard[j][i]];
+
+            for (int16_t y = 0 ; y < tileHeight ; ++y)
+            {
+                for (int16_t x = 0 ; x < tileWidth ; ++x)
+                {
+                    const Image8880Point p{ x, y };
+                    const Image8880Point q(x + (i * tileWidth),
+                                           y + (j * tileHeight));
+
+                    m_static.setPixel(q, tile.getPixel(p).second);
+                }
+            }
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+BoardRenderer::restore(
+    FrameBuffer8880& fb,
+    const FB8880Point& origin,
+    int x,
+    int y,
+    int width,
+    int height)
+{
+    const int left = std::max(x, 0);
+    const int top = std::max(y, 0);
+    const int right = std::min(x + width, static_cast<int>(m_static.getWidth()));
+    const int bottom = std::min(y + height, static_cast<int>(m_static.getHeight()));
+
+    if ((left >= right) or (top >= bottom))
+    {
+        return;
+    }
+
+    for (int column = left ; column < right ; ++column)
+    {
+        uint32_t* destination = fb.getColumn(origin.x() + column);
+
+        if (destination != nullptr)
+        {
+            // Image columns are stored right to left, as the frame buffer
+            // lines are.
+
+            const uint32_t* source =
+                m_static.getColumn(m_static.getWidth() - 1 - column);
+
+            std::copy(source + top,
+                      source + bottom,
+                      destination + origin.y() + top);
+        }
+    }
+
+    fb.addDamage(FB8880Point{ origin.x() + left, origin.y() + top },
+                 right - left,
+                 bottom - top);
+
+    // The squares touched now show the static layer, so any piece on them
+    // has to be drawn again.
+
+    for (int j = top / tileHeight ; j <= (bottom - 1) / tileHeight ; ++j)
+    {
+        for (int i = left / tileWidth ; i <= (right - 1) / tileWidth ; ++i)
+        {
+            m_drawn[j][i] = m_staticBoard[j][i];
+        }
+    }
+}
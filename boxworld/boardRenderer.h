@@ -0,0 +1,88 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <array>
+
+#include "framebuffer8880.h"
+#include "image8880.h"
+
+#include "images.h"
+#include "level.h"
+
+//-------------------------------------------------------------------------
+
+// Draws the board from a pre-rendered image of the parts that don't move
+// (walls, passages and targets), which is only rebuilt when they change.
+// Each frame only the squares that have changed since the last frame are
+// drawn to the frame buffer. Squares a box or the player has left, and the
+// areas sprites were drawn over, are copied back from the pre-rendered
+// image. Everything drawn is added to the frame buffer damage.
+
+class BoardRenderer
+{
+public:
+
+    using Tiles = std::array<ogsfb32::ConstImageView8880, tileCount>;
+
+    BoardRenderer();
+
+    static uint8_t staticPiece(uint8_t piece);
+
+    // Returns true if the whole board was drawn.
+
+    bool
+    draw(
+        ogsfb32::FrameBuffer8880& fb,
+        const ogsfb32::FB8880Point& origin,
+        const Level::LevelType& board,
+        const Tiles& tiles);
+
+    // Restore the static layer in an area given in pixels from the origin.
+
+    void
+    restore(
+        ogsfb32::FrameBuffer8880& fb,
+        const ogsfb32::FB8880Point& origin,
+        int x,
+        int y,
+        int width,
+        int height);
+
+private:
+
+    void renderStatic(const Tiles& tiles);
+
+    ogsfb32::Image8880 m_static;
+    Level::LevelType m_staticBoard;
+    Level::LevelType m_drawn;
+    bool m_valid;
+};
@@ -25,9 +25,16 @@
 //
 //-------------------------------------------------------------------------
 
+#include <sys/stat.h>
+
+#include <chrono>
+#include <cstdlib>
+
 #include "image8880Font.h"
+#include "profiler.h"
 
 #include "boxworld.h"
+#include "boxworldImages.h"
 #include "images.h"
 
 //-------------------------------------------------------------------------
@@ -36,34 +43,152 @@ using namespace ogsfb32;
 
 //-------------------------------------------------------------------------
 
-Boxworld::Boxworld()
+namespace
+{
+
+constexpr std::array<Boxworld::Location, 4> steps
+{ {
+    { 0, -1 },
+    { 0, 1 },
+    { -1, 0 },
+    { 1, 0 }
+} };
+
+// The board has a line of text above it and two below, and these are
+// centred on the screen.
+
+constexpr int boardY = 20;
+constexpr int boardWidth = Level::levelWidth * tileWidth;
+constexpr int boardHeight = Level::levelHeight * tileHeight;
+constexpr int layoutHeight = boardY + boardHeight + 40;
+
+// The images are generated from the PNG files in assets when boxworld is
+// built, as constant arrays.
+
+static_assert(emptyImage.size() == tileWidth * tileHeight);
+static_assert(passageImage.size() == tileWidth * tileHeight);
+static_assert(boxImage.size() == tileWidth * tileHeight);
+static_assert(playerImage.size() == 2 * tileWidth * tileHeight);
+static_assert(wallImage.size() == tileWidth * tileHeight);
+static_assert(passageWithTargetImage.size() == tileWidth * tileHeight);
+static_assert(boxOnTargetImage.size() == tileWidth * tileHeight);
+static_assert(playerOnTargetImage.size() == 2 * tileWidth * tileHeight);
+
+constexpr std::chrono::milliseconds moveDuration{150};
+constexpr std::chrono::milliseconds playerFrameDuration{500};
+
+//-------------------------------------------------------------------------
+
+FB8880Point
+squarePosition(
+    const FB8880Point& origin,
+    const Boxworld::Location& location)
+{
+    return FB8880Point{ origin.x() + (location.x * tileWidth),
+                        origin.y() + (location.y * tileHeight) };
+}
+
+//-------------------------------------------------------------------------
+
+// The board is drawn from the first frame of each tile, where it is in
+// the image data.
+
+template<size_t SIZE>
+ConstImageView8880
+tileView(
+    const std::array<uint32_t, SIZE>& image)
+{
+    return ConstImageView8880(image.data(), tileWidth, tileHeight, tileHeight);
+}
+
+//-------------------------------------------------------------------------
+
+// The player is drawn as a sprite over the board, so the pixels it shares
+// with the plain passage tile are made transparent.
+
+std::vector<uint32_t>
+playerSpriteImage()
+{
+    std::vector<uint32_t> image(playerImage.begin(), playerImage.end());
+
+    for (size_t i = 0 ; i < image.size() ; ++i)
+    {
+        if (image[i] == passageImage[i % passageImage.size()])
+        {
+            image[i] = Sprite::transparent;
+        }
+    }
+
+    return image;
+}
+
+}
+
+//-------------------------------------------------------------------------
+
+Boxworld::Boxworld(
+    const FrameBuffer8880& fb,
+    const std::string& levelPack)
 :
     m_level{0},
     m_levelSolved{false},
-    m_canUndo{false},
     m_player{ 0, 0 },
     m_board(),
-    m_boardPrevious(),
-    m_levels(),
+    m_levels(levelPack),
+    m_history(),
+    m_historyDirectory(),
+    m_cancelSolver{false},
+    m_solverResult{},
+    m_solving{false},
+    m_haveSolution{false},
+    m_solution{},
+    m_solutionStep{0},
+    m_showHint{false},
+    m_autoSolve{false},
     m_tileBuffers(
         { {
-            { tileWidth, tileHeight, emptyImage },
-            { tileWidth, tileHeight, passageImage },
-            { tileWidth, tileHeight, boxImage },
-            { tileWidth, tileHeight, playerImage, 2 },
-            { tileWidth, tileHeight, wallImage },
-            { tileWidth, tileHeight, passageWithTargetImage },
-            { tileWidth, tileHeight, boxOnTargetImage },
-            { tileWidth, tileHeight, playerOnTargetImage, 2 }
+            tileView(emptyImage),
+            tileView(passageImage),
+            tileView(boxImage),
+            tileView(playerImage),
+            tileView(wallImage),
+            tileView(passageWithTargetImage),
+            tileView(boxOnTargetImage),
+            tileView(playerOnTargetImage)
         } }),
-    m_topTextImage{ 480, 20 },
-    m_bottomTextImage{ 480, 40 },
+    m_boardRenderer(),
+    m_boardOrigin{ (fb.getWidth() - boardWidth) / 2,
+                   ((fb.getHeight() - layoutHeight) / 2) + boardY },
+    m_clock(),
+    m_playerSprite{
+        Image8880{ tileWidth, tileHeight, playerSpriteImage(), 2 },
+        Animation{ { { 0, playerFrameDuration }, { 1, playerFrameDuration } } }},
+    m_boxSprite{ Image8880{ tileWidth, tileHeight, boxImage.data() } },
+    m_movingBox{ 0, 0 },
+    m_topTextImage{ boardWidth, boardY },
+    m_bottomTextImage{ boardWidth, layoutHeight - boardY - boardHeight },
     m_textRGB(255, 255, 255),
     m_boldRGB(255, 255, 0),
     m_disabledRGB(170, 170, 170),
     m_solvedRGB(255, 0, 255),
     m_backgroundRGB(0, 0, 0)
 {
+    const char* home = ::getenv("HOME");
+
+    if (home != nullptr)
+    {
+        m_historyDirectory = std::string(home) + "/.boxworld";
+    }
+
+    m_boxSprite.hide();
+}
+
+//-------------------------------------------------------------------------
+
+Boxworld::~Boxworld()
+{
+    stopSolver();
+    saveHistory();
 }
 
 //-------------------------------------------------------------------------
@@ -71,11 +196,24 @@ Boxworld::Boxworld()
 void
 Boxworld::init()
 {
-    m_levelSolved = false;
-    m_board = m_levels.level(m_level);
-    m_boardPrevious = m_board;
-    m_canUndo = false;
-    findPlayer();
+    restart();
+
+    // Replay the moves saved when the level was last played, stopping
+    // before the first one that doesn't fit the board.
+
+    for (const char letter : MoveHistory::load(historyFile()))
+    {
+        MoveHistory::Move move;
+
+        if (not MoveHistory::fromLURD(letter, move) or not fits(move))
+        {
+            break;
+        }
+
+        movePlayer(move.direction);
+    }
+
+    placeSprites();
 }
 
 //-------------------------------------------------------------------------
@@ -83,85 +221,83 @@ Boxworld::init()
 void
 Boxworld::update(Joystick& js)
 {
+    ProfileScope profileScope{"update"};
+
+    const auto elapsed = m_clock.tick();
+    m_playerSprite.update(elapsed);
+    m_boxSprite.update(elapsed);
+
+    if (m_boxSprite.isVisible() and not m_boxSprite.isMoving())
+    {
+        m_boxSprite.hide();
+    }
+
     if (js.buttonPressed(Joystick::BUTTON_A))
     {
-        if (m_level < (Level::levelCount - 1))
+        if (m_level < (m_levels.count() - 1))
         {
-            ++m_level;
-            init();
+            changeLevel(m_level + 1);
         }
     }
     else if (js.buttonPressed(Joystick::BUTTON_B))
     {
         if (m_level > 0)
         {
-            --m_level;
-            init();
+            changeLevel(m_level - 1);
         }
     }
     else if (js.buttonPressed(Joystick::BUTTON_X))
     {
-        if (m_canUndo)
-        {
-            m_board = m_boardPrevious;
-            findPlayer();
-            m_canUndo = false;
-        }
+        undoMoves();
+    }
+    else if (js.buttonPressed(Joystick::BUTTON_RIGHT_SHOULDER_INNER))
+    {
+        redoMoves();
     }
     else if (js.buttonPressed(Joystick::BUTTON_Y))
     {
-        init();
+        restart();
     }
-    else
+    else if (js.buttonPressed(Joystick::BUTTON_LEFT_SHOULDER_OUTER))
     {
-        int dx = 0;
-        int dy = 0;
-
-        if (js.buttonPressed(Joystick::BUTTON_DPAD_UP))
-        {
-            dy = -1;
-        }
-        else if (js.buttonPressed(Joystick::BUTTON_DPAD_DOWN))
+        if (not m_levelSolved)
         {
-            dy = 1;
+            m_showHint = true;
+            startSolver();
         }
-        else if (js.buttonPressed(Joystick::BUTTON_DPAD_LEFT))
+    }
+    else if (js.buttonPressed(Joystick::BUTTON_RIGHT_SHOULDER_OUTER))
+    {
+        if (not m_levelSolved)
         {
-            dx = -1;
+            m_autoSolve = not m_autoSolve;
+            startSolver();
         }
-        else if (js.buttonPressed(Joystick::BUTTON_DPAD_RIGHT))
+    }
+    else
+    {
+        constexpr std::array<Joystick::Buttons, 4> buttons
         {
-            dx = 1;
-        }
+            Joystick::BUTTON_DPAD_UP,
+            Joystick::BUTTON_DPAD_DOWN,
+            Joystick::BUTTON_DPAD_LEFT,
+            Joystick::BUTTON_DPAD_RIGHT
+        };
 
-        if ((dx != 0) or (dy != 0))
+        for (int direction = MoveHistory::UP ; direction <= MoveHistory::RIGHT ; ++direction)
         {
-            Location next{ .x = m_player.x + dx, .y = m_player.y + dy };
-            auto piece1 = m_board[next.y][next.x] & ~targetMask;
-
-            if (piece1 == PASSAGE)
-            {
-                swapPieces(m_player, next);
-                m_player = next;
-            }
-            else if (piece1 == BOX)
+            if (js.buttonPressed(buttons[direction]))
             {
-                Location afterBox{ .x = next.x + dx, .y = next.y + dy };
-                auto piece2 = m_board[afterBox.y][afterBox.x] & ~targetMask;
-
-                if (piece2 == PASSAGE)
-                {
-                    m_boardPrevious =  m_board;
-                    swapPieces(next, afterBox);
-                    swapPieces(m_player, next);
-                    m_player = next;
-
-                    isLevelSolved();
-                    m_canUndo = not m_levelSolved;
-                }
+                // Moving by hand leaves the board the solution was found for.
+
+                stopSolver();
+                movePlayer(static_cast<MoveHistory::Direction>(direction));
+                break;
             }
         }
     }
+
+    playSolution();
 }
 
 //-------------------------------------------------------------------------
@@ -178,47 +314,82 @@ Boxworld::draw(FrameBuffer8880& fb)
 void
 Boxworld::drawBoard(FrameBuffer8880& fb)
 {
-    constexpr int xOffset = 187;
-    constexpr int yOffset = 20;
-    static uint8_t frame = 0;
+    ProfileScope profileScope{"drawBoard"};
+
+    // The squares under the sprites are drawn as if they were empty.
+
+    Level::LevelType shown = m_board;
+    auto& playerSquare = shown[m_player.y][m_player.x];
+    playerSquare = BoardRenderer::staticPiece(playerSquare);
 
-    for (int j = 0 ; j < Level::levelHeight ; ++j)
+    if (m_boxSprite.isVisible())
     {
-        for (int i = 0 ; i < Level::levelWidth ; ++i)
-        {
-            auto piece = m_board[j][i];
-            auto& tile = m_tileBuffers[piece];
+        auto& boxSquare = shown[m_movingBox.y][m_movingBox.x];
+        boxSquare = BoardRenderer::staticPiece(boxSquare);
+    }
 
-            if (tile.getNumberOfFrames() > 1)
+    const bool dirty = m_playerSprite.isDirty() or m_boxSprite.isDirty();
+
+    if (dirty)
+    {
+        for (const auto sprite : { &m_boxSprite, &m_playerSprite })
+        {
+            if (sprite->isDrawn())
             {
-                tile.setFrame(frame / 2);
+                const auto& position = sprite->getDrawnPosition();
+
+                m_boardRenderer.restore(fb,
+                                        m_boardOrigin,
+                                        position.x() - m_boardOrigin.x(),
+                                        position.y() - m_boardOrigin.y(),
+                                        sprite->getWidth(),
+                                        sprite->getHeight());
             }
-
-            fb.putImage(
-                FB8880Point{
-                    (i * tileWidth) + xOffset,
-                    (j * tileHeight) + yOffset
-                },
-                tile);
         }
     }
 
-    if (frame < 3)
-    {
-        ++frame;
-    }
-    else
+    const bool full = m_boardRenderer.draw(fb, m_boardOrigin, shown, m_tileBuffers);
+
+    if (dirty or full)
     {
-        frame = 0;
+        m_boxSprite.draw(fb);
+        m_playerSprite.draw(fb);
     }
 }
 
 //-------------------------------------------------------------------------
 
+Boxworld::TextState
+Boxworld::textState() const
+{
+    return TextState{ m_level,
+                      m_levelSolved,
+                      m_solving,
+                      m_haveSolution,
+                      m_solution.solved,
+                      m_solution.exhausted,
+                      m_solution.pushes,
+                      m_history.canUndo() };
+}
+
+//-------------------------------------------------------------------------
+
 void
 Boxworld::drawText(FrameBuffer8880& fb)
 {
-    constexpr int xOffset = 187;
+    ProfileScope profileScope{"drawText"};
+
+    // The text only changes with the game state, so most frames have
+    // nothing to draw here.
+
+    const auto state = textState();
+
+    if (m_drawnText == state)
+    {
+        return;
+    }
+
+    m_drawnText = state;
 
     //---------------------------------------------------------------------
 
@@ -232,16 +403,44 @@ Boxworld::drawText(FrameBuffer8880& fb)
     {
         position = drawString(position, " [solved]", m_solvedRGB, m_topTextImage);
     }
+    else if (m_solving)
+    {
+        position = drawString(position, "  solver: ", m_boldRGB, m_topTextImage);
+        position = drawString(position, "solving...", m_textRGB, m_topTextImage);
+    }
+    else if (m_haveSolution)
+    {
+        position = drawString(position, "  solver: ", m_boldRGB, m_topTextImage);
+
+        if (m_solution.solved)
+        {
+            const auto text = std::to_string(m_solution.pushes) + " pushes";
+            position = drawString(position, text, m_textRGB, m_topTextImage);
+        }
+        else if (m_solution.exhausted)
+        {
+            position = drawString(position, "gave up", m_disabledRGB, m_topTextImage);
+        }
+        else
+        {
+            position = drawString(position, "no solution", m_disabledRGB, m_topTextImage);
+        }
+    }
 
-    fb.putImage(FB8880Point{ xOffset, 0 }, m_topTextImage);
+    const FB8880Point topPosition{ m_boardOrigin.x(), m_boardOrigin.y() - boardY };
+
+    fb.putImage(topPosition, m_topTextImage);
+    fb.addDamage(topPosition,
+                 m_topTextImage.getWidth(),
+                 m_topTextImage.getHeight());
 
     //---------------------------------------------------------------------
 
     position = FontPoint{ 2, 2 };
-    auto& undoRGB = ((m_canUndo) ? m_textRGB : m_disabledRGB);
+    auto& undoRGB = ((m_history.canUndo()) ? m_textRGB : m_disabledRGB);
 
     position = drawString(position, "(X): ", m_boldRGB, m_bottomTextImage); 
-    position = drawString(position, "undox box move", undoRGB, m_bottomTextImage); 
+    position = drawString(position, "undo box move", undoRGB, m_bottomTextImage); 
 
     position = FontPoint{ 2, 18 };
 
@@ -251,7 +450,7 @@ Boxworld::drawText(FrameBuffer8880& fb)
     int16_t halfWidth = 2 + (m_bottomTextImage.getWidth() / 2);
 
     position = FontPoint{ halfWidth, 2 };
-    auto& nextRGB = ((m_level < (Level::levelCount - 1)) ? m_textRGB : m_disabledRGB);
+    auto& nextRGB = ((m_level < (m_levels.count() - 1)) ? m_textRGB : m_disabledRGB);
 
     position = drawString(position, "(A): ", m_boldRGB, m_bottomTextImage); 
     position = drawString(position, "next level", nextRGB, m_bottomTextImage); 
@@ -262,7 +461,13 @@ Boxworld::drawText(FrameBuffer8880& fb)
     position = drawString(position, "(B): ", m_boldRGB, m_bottomTextImage); 
     position = drawString(position, "previous level", previousRGB, m_bottomTextImage); 
 
-    fb.putImage(FB8880Point{ xOffset, 440 }, m_bottomTextImage);
+    const FB8880Point bottomPosition{ m_boardOrigin.x(),
+                                      m_boardOrigin.y() + boardHeight };
+
+    fb.putImage(bottomPosition, m_bottomTextImage);
+    fb.addDamage(bottomPosition,
+                 m_bottomTextImage.getWidth(),
+                 m_bottomTextImage.getHeight());
 }
 
 //-------------------------------------------------------------------------
@@ -288,6 +493,297 @@ Boxworld::findPlayer()
 
 //-------------------------------------------------------------------------
 
+void
+Boxworld::changeLevel(
+    int level)
+{
+    saveHistory();
+    m_level = level;
+    init();
+}
+
+//-------------------------------------------------------------------------
+
+void
+Boxworld::restart()
+{
+    stopSolver();
+    m_levelSolved = false;
+    m_board = m_levels.level(m_level);
+    m_history.clear();
+    findPlayer();
+    placeSprites();
+}
+
+//-------------------------------------------------------------------------
+
+bool
+Boxworld::fits(
+    const MoveHistory::Move& move) const
+{
+    // The move can be made, and pushes a box exactly when it says it does.
+
+    const auto& offset = steps[move.direction];
+    const int dx = offset.x;
+    const int dy = offset.y;
+
+    const Location next{ .x = m_player.x + dx, .y = m_player.y + dy };
+    const auto piece1 = m_board[next.y][next.x] & ~targetMask;
+
+    if (piece1 == PASSAGE)
+    {
+        return not move.push;
+    }
+    else if ((piece1 == BOX) and move.push)
+    {
+        const Location afterBox{ .x = next.x + dx, .y = next.y + dy };
+
+        return (m_board[afterBox.y][afterBox.x] & ~targetMask) == PASSAGE;
+    }
+
+    return false;
+}
+
+//-------------------------------------------------------------------------
+
+bool
+Boxworld::step(
+    MoveHistory::Move& move)
+{
+    const auto& offset = steps[move.direction];
+    const int dx = offset.x;
+    const int dy = offset.y;
+
+    Location next{ .x = m_player.x + dx, .y = m_player.y + dy };
+    auto piece1 = m_board[next.y][next.x] & ~targetMask;
+
+    move.push = false;
+
+    if (piece1 == PASSAGE)
+    {
+        swapPieces(m_player, next);
+        m_player = next;
+        m_playerSprite.moveTo(squarePosition(m_boardOrigin, m_player), moveDuration);
+
+        return true;
+    }
+    else if (piece1 == BOX)
+    {
+        Location afterBox{ .x = next.x + dx, .y = next.y + dy };
+        auto piece2 = m_board[afterBox.y][afterBox.x] & ~targetMask;
+
+        if (piece2 == PASSAGE)
+        {
+            swapPieces(next, afterBox);
+            swapPieces(m_player, next);
+            m_player = next;
+            move.push = true;
+
+            m_playerSprite.moveTo(squarePosition(m_boardOrigin, m_player), moveDuration);
+            m_boxSprite.setPosition(squarePosition(m_boardOrigin, next));
+            m_boxSprite.moveTo(squarePosition(m_boardOrigin, afterBox), moveDuration);
+            m_boxSprite.show();
+            m_movingBox = afterBox;
+
+            isLevelSolved();
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//-------------------------------------------------------------------------
+
+bool
+Boxworld::movePlayer(
+    MoveHistory::Direction direction)
+{
+    MoveHistory::Move move{ direction, false };
+
+    if (step(move))
+    {
+        m_history.record(move);
+    }
+
+    return move.push;
+}
+
+//-------------------------------------------------------------------------
+
+void
+Boxworld::undoMoves()
+{
+    // Step back through the moves up to and including the last push.
+
+    stopSolver();
+
+    bool pushed = false;
+
+    while (m_history.canUndo() and not pushed)
+    {
+        const auto move = m_history.undo();
+        const auto& offset = steps[move.direction];
+
+        Location previous{ .x = m_player.x - offset.x, .y = m_player.y - offset.y };
+        swapPieces(m_player, previous);
+
+        if (move.push)
+        {
+            Location box{ .x = m_player.x + offset.x, .y = m_player.y + offset.y };
+            swapPieces(box, m_player);
+            pushed = true;
+        }
+
+        m_player = previous;
+    }
+
+    isLevelSolved();
+    placeSprites();
+}
+
+//-------------------------------------------------------------------------
+
+void
+Boxworld::redoMoves()
+{
+    // Replay the undone moves up to and including the next push.
+
+    stopSolver();
+
+    bool pushed = false;
+
+    while (m_history.canRedo() and not pushed)
+    {
+        auto move = m_history.redo();
+        step(move);
+        pushed = move.push;
+    }
+
+    placeSprites();
+}
+
+//-------------------------------------------------------------------------
+
+void
+Boxworld::placeSprites()
+{
+    m_playerSprite.setPosition(squarePosition(m_boardOrigin, m_player));
+    m_boxSprite.hide();
+}
+
+//-------------------------------------------------------------------------
+
+std::string
+Boxworld::historyFile() const
+{
+    if (m_historyDirectory.empty())
+    {
+        return "";
+    }
+
+    const auto pack = m_levels.name();
+    const auto prefix = (pack.empty()) ? std::string("level") : pack + "-";
+
+    return m_historyDirectory + "/" + prefix + std::to_string(m_level + 1) + ".lurd";
+}
+
+//-------------------------------------------------------------------------
+
+void
+Boxworld::saveHistory() const
+{
+    if (not m_historyDirectory.empty())
+    {
+        ::mkdir(m_historyDirectory.c_str(), 0755);
+        m_history.save(historyFile());
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+Boxworld::startSolver()
+{
+    if (m_solving or m_haveSolution)
+    {
+        return;
+    }
+
+    m_cancelSolver = false;
+    m_solving = true;
+    m_solverResult = std::async(
+        std::launch::async,
+        [board = m_board, this]
+        {
+            Solver solver{board};
+            return solver.solve(&m_cancelSolver);
+        });
+}
+
+//-------------------------------------------------------------------------
+
+void
+Boxworld::stopSolver()
+{
+    if (m_solving)
+    {
+        m_cancelSolver = true;
+        m_solverResult.wait();
+        m_solving = false;
+    }
+
+    m_haveSolution = false;
+    m_solutionStep = 0;
+    m_showHint = false;
+    m_autoSolve = false;
+}
+
+//-------------------------------------------------------------------------
+
+void
+Boxworld::playSolution()
+{
+    using namespace std::chrono_literals;
+
+    if (m_solving and
+        (m_solverResult.wait_for(0s) == std::future_status::ready))
+    {
+        m_solution = m_solverResult.get();
+        m_solutionStep = 0;
+        m_solving = false;
+        m_haveSolution = true;
+    }
+
+    if (not m_haveSolution or
+        not (m_showHint or m_autoSolve) or
+        m_playerSprite.isMoving())
+    {
+        return;
+    }
+
+    if (m_solutionStep >= m_solution.moves.size())
+    {
+        m_showHint = false;
+        m_autoSolve = false;
+        return;
+    }
+
+    // Play each move once the last has finished. A hint stops after the
+    // next push.
+
+    MoveHistory::Move move;
+
+    if (MoveHistory::fromLURD(m_solution.moves[m_solutionStep++], move) and
+        movePlayer(move.direction))
+    {
+        m_showHint = false;
+    }
+}
+
+//-------------------------------------------------------------------------
+
 void
 Boxworld::swapPieces(const Location& location1, const Location& location2)
 {
@@ -29,13 +29,24 @@
 
 //-------------------------------------------------------------------------
 
+#include <atomic>
+#include <future>
+#include <optional>
+#include <string>
+#include <tuple>
+
+#include "frameClock.h"
 #include "framebuffer8880.h"
 #include "image8880.h"
 #include "joystick.h"
+#include "sprite.h"
 
+#include "boardRenderer.h"
 #include "images.h"
 #include "level.h"
 #include "levels.h"
+#include "moveHistory.h"
+#include "solver.h"
 
 //-------------------------------------------------------------------------
 
@@ -72,7 +83,12 @@ public:
 
     //---------------------------------------------------------------------
 
-    Boxworld();
+    // The board is centred on the frame buffer's screen.
+
+    explicit Boxworld(
+        const ogsfb32::FrameBuffer8880& fb,
+        const std::string& levelPack = "");
+    ~Boxworld();
 
     void init();
     void update(ogsfb32::Joystick& js);
@@ -80,26 +96,60 @@ public:
 
 private:
 
+    using TextState = std::tuple<int, bool, bool, bool, bool, bool, int, bool>;
+
+    void changeLevel(int level);
+    void restart();
     void findPlayer();
+    bool fits(const MoveHistory::Move& move) const;
+    bool step(MoveHistory::Move& move);
+    bool movePlayer(MoveHistory::Direction direction);
+    void undoMoves();
+    void redoMoves();
+    void placeSprites();
+    std::string historyFile() const;
+    void saveHistory() const;
+    void startSolver();
+    void stopSolver();
+    void playSolution();
     void swapPieces(const Location& location1, const Location& location2);
     void isLevelSolved();
     void drawBoard(ogsfb32::FrameBuffer8880& fb);
+    TextState textState() const;
     void drawText(ogsfb32::FrameBuffer8880& fb);
 
     //---------------------------------------------------------------------
 
     int m_level;
     bool m_levelSolved;
-    bool m_canUndo;
 
     Location m_player;
     Level::LevelType m_board;
-    Level::LevelType m_boardPrevious;
     const Levels m_levels;
 
-    std::array<ogsfb32::Image8880, tileCount> m_tileBuffers;
+    MoveHistory m_history;
+    std::string m_historyDirectory;
+
+    std::atomic<bool> m_cancelSolver;
+    std::future<Solver::Result> m_solverResult;
+    bool m_solving;
+    bool m_haveSolution;
+    Solver::Result m_solution;
+    size_t m_solutionStep;
+    bool m_showHint;
+    bool m_autoSolve;
+
+    BoardRenderer::Tiles m_tileBuffers;
+    BoardRenderer m_boardRenderer;
+
+    ogsfb32::FB8880Point m_boardOrigin;
+    ogsfb32::FrameClock m_clock;
+    ogsfb32::Sprite m_playerSprite;
+    ogsfb32::Sprite m_boxSprite;
+    Location m_movingBox;
     ogsfb32::Image8880 m_topTextImage;
     ogsfb32::Image8880 m_bottomTextImage;
+    std::optional<TextState> m_drawnText;
 
     ogsfb32::RGB8880 m_textRGB;
     ogsfb32::RGB8880 m_boldRGB;
@@ -1,964 +0,0 @@
-
-//-------------------------------------------------------------------------
-//
-// The MIT License (MIT)
-//
-// Copyright (c) 2022 Andrew Duncan
-//
-// Permission is hereby granted, free of charge, to any person obtaining a
-// copy of this software and associated documentation files (the
-// "Software"), to deal in the Software without restriction, including
-// without limitation the rights to use, copy, modify, merge, publish,
-// distribute, sublicense, and/or sell copies of the Software, and to
-// permit persons to whom the Software is furnished to do so, subject to
-// the following conditions:
-//
-// The above copyright notice and this permission notice shall be included
-// in all copies or substantial portions of the Software.
-//
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
-// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
-// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
-// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
-// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
-// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
-// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
-//
-//-------------------------------------------------------------------------
-
-#include <cstdint>
-#include <vector>
-
-//-------------------------------------------------------------------------
-
-std::vector<uint32_t> emptyImage = 
-{
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-};
-
-std::vector<uint32_t> passageImage = 
-{
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x0000ffff, 
-    0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 
-    0x0000ffff, 0x0000ffff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x0000ffff, 
-    0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 
-    0x0000ffff, 0x0000ffff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-};
-
-std::vector<uint32_t> boxImage = 
-{
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 0x00008000, 0x00000000, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00000000, 0x00008000, 0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 
-    0x00008000, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 
-    0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 
-    0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00008000, 
-    0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 0x00008000, 0x00000000, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00000000, 0x00008000, 0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00000000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00000000, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 0x00008000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-};
-
-std::vector<uint32_t> playerImage = 
-{
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x00ffffff, 0x00ffffff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ffffff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00c0c0c0, 0x00000000, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00000000, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00808080, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00808080, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00808080, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00ff00ff, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00000000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00000000, 0x00ffffff, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00800000, 0x00800000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x0000ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00800000, 0x00800000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00808080, 0x00808080, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00808080, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00800000, 0x00800000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00808080, 0x00808080, 0x00808080, 
-    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00800000, 0x00800000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00808080, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00808080, 0x00808080, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00800000, 0x00000000, 
-    0x00ffffff, 0x00ffffff, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00000000, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00ff0000, 0x00ff0000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x00000000, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00000000, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 
-    0x00ffffff, 0x00ffffff, 0x00ff0000, 0x00ff0000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00ff00ff, 0x00ffffff, 0x00ff0000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00ff00ff, 0x00000000, 0x00ff0000, 0x00000000, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00808080, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00ff00ff, 0x00000000, 0x00ff0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00808080, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x00000000, 0x000000ff, 0x00000000, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x000000ff, 
-    0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x000000ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00ff0000, 
-    0x00ff0000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00ff0000, 
-    0x00ff0000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x000000ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x00000000, 0x000000ff, 0x00000000, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x000000ff, 
-    0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00808080, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00808080, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00ff00ff, 0x00000000, 0x00ff0000, 0x00000000, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00ff00ff, 0x00000000, 0x00ff0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00ff00ff, 0x00ffffff, 0x00ff0000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x00000000, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00000000, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 
-    0x00ffffff, 0x00ffffff, 0x00ff0000, 0x00ff0000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00000000, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00ff0000, 0x00ff0000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00808080, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00808080, 0x00808080, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00800000, 0x00000000, 
-    0x00ffffff, 0x00ffffff, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00808080, 0x00808080, 0x00808080, 
-    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00800000, 0x00800000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x0000ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00808080, 0x00808080, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00808080, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00800000, 0x00800000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00800000, 0x00800000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00000000, 0x00ffffff, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00800000, 0x00800000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00000000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00808080, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00808080, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00ff00ff, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00808080, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00c0c0c0, 0x00000000, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00000000, 0x000000ff, 0x00000000, 0x0000ffff, 0x0000ffff, 0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ffffff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x00ffffff, 0x00ffffff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 
-    0x0000ffff, 0x0000ffff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-};
-
-std::vector<uint32_t> wallImage = 
-{
-    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 
-    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 
-    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 
-    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 
-    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00808080, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-    0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00808080, 0x00ffffff, 0x00ffffff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00808080, 0x00808080, 
-};
-
-std::vector<uint32_t> passageWithTargetImage = 
-{
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x0000ffff, 
-    0x0000ffff, 0x0000ffff, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffffff, 0x00ffffff, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x0000ff00, 0x00ffff00, 
-    0x00808000, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00ffff00, 0x00ffff00, 
-    0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x0000ff00, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00ffff00, 0x00ffff00, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x0000ff00, 
-    0x00808000, 0x00808000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00ffff00, 0x00ffff00, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x0000ff00, 0x0000ff00, 
-    0x0000ff00, 0x00808000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00808000, 
-    0x0000ff00, 0x00808000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffffff, 0x00ffffff, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x0000ff00, 0x00ffff00, 0x0000ff00, 
-    0x0000ff00, 0x00808000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x0000ff00, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x0000ff00, 0x00ffff00, 0x0000ff00, 0x00808000, 
-    0x0000ff00, 0x00808000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00ffff00, 0x0000ff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x0000ff00, 0x00ffff00, 0x0000ff00, 
-    0x00808000, 0x00808000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ff00, 0x0000ff00, 
-    0x0000ff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x00ffff00, 0x0000ff00, 0x0000ff00, 0x00ffff00, 0x00808000, 0x0000ff00, 
-    0x00808000, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ff00, 0x0000ff00, 
-    0x0000ff00, 0x0000ff00, 0x0000ff00, 0x00ffff00, 0x0000ff00, 0x0000ff00, 0x00808000, 0x0000ff00, 0x0000ff00, 0x00808000, 
-    0x00808000, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x0000ff00, 
-    0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x00808000, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x00808000, 0x00808000, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x0000ffff, 
-    0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x0000ff00, 0x00808000, 0x00808000, 0x00808000, 0x00808000, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00808000, 0x00808000, 0x00808000, 0x00808000, 0x00808000, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 
-    0x0000ffff, 0x0000ffff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-};
-
-std::vector<uint32_t> boxOnTargetImage = 
-{
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00000000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00000000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00000000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00000000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 0x00800000, 0x00000000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00000000, 0x00800000, 0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 0x00800000, 0x00800000, 0x00000000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00000000, 0x00800000, 0x00800000, 0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 
-    0x00800000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 
-    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 
-    0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00800000, 
-    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 0x00800000, 0x00800000, 0x00000000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00000000, 0x00800000, 0x00800000, 0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 0x00800000, 0x00000000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00000000, 0x00800000, 0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00000000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00000000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00000000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00000000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00000000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00000000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 0x00800000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-};
-
-std::vector<uint32_t> playerOnTargetImage = 
-{
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x00ffffff, 0x00ffffff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ffffff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00c0c0c0, 0x00000000, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00000000, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00808080, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x009f9f5f, 0x00ffff41, 
-    0x00ffff00, 0x00ffff41, 0x009f9f5f, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00ff00ff, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffff61, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff61, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffff20, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff20, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00000000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffff20, 0x00ffff00, 
-    0x00ffff00, 0x00404000, 0x00ffff20, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00800000, 0x00800000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x0000ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffff61, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff61, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00800000, 0x00800000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00808080, 0x009f9f5f, 0x00ffff41, 
-    0x00ffff00, 0x00ffff41, 0x009f9f5f, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00800000, 0x00800000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00808080, 0x00808080, 0x00808080, 
-    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00800000, 0x00800000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x009f9f5f, 0x00ffff41, 0x00ffff00, 
-    0x00ffff41, 0x009f9f5f, 0x00808080, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00800000, 0x00000000, 
-    0x00ffffff, 0x00ffffff, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffff61, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff61, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00000000, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00ff0000, 0x00ff0000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x00000000, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00ffff20, 0x00404000, 0x00ffff00, 
-    0x00ffff00, 0x00ffff20, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 
-    0x00ffffff, 0x00ffffff, 0x00ff0000, 0x00ff0000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffff20, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff20, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00ff00ff, 0x00ffffff, 0x00ff0000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffff61, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff61, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00ff00ff, 0x00000000, 0x00ff0000, 0x00000000, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00404000, 0x00ffff41, 0x00ffff00, 
-    0x00ffff41, 0x009f9f5f, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00ff00ff, 0x00000000, 0x00ff0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00808080, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x00000000, 0x000000ff, 0x00000000, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x000000ff, 
-    0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x000000ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00ff0000, 
-    0x00ff0000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00ff0000, 
-    0x00ff0000, 0x00000000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x000000ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x00ff0000, 
-    0x00ff0000, 0x00ff0000, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x00000000, 0x000000ff, 0x00000000, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x000000ff, 
-    0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 
-    0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00808080, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00404000, 0x00ffff41, 0x00ffff00, 
-    0x00ffff41, 0x009f9f5f, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00ff00ff, 0x00000000, 0x00ff0000, 0x00000000, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffff61, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff61, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00ff00ff, 0x00000000, 0x00ff0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffff20, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff20, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00ff00ff, 0x00ffffff, 0x00ff0000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x00000000, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00ffff20, 0x00404000, 0x00ffff00, 
-    0x00ffff00, 0x00ffff20, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 
-    0x00ffffff, 0x00ffffff, 0x00ff0000, 0x00ff0000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffff61, 0x00ffff00, 0x00ffff00, 
-    0x00ffff00, 0x00ffff61, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00000000, 0x00ffffff, 
-    0x00ffffff, 0x00ffffff, 0x00ff0000, 0x00ff0000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x009f9f5f, 0x00ffff41, 0x00ffff00, 
-    0x00ffff41, 0x009f9f5f, 0x00808080, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00800000, 0x00000000, 
-    0x00ffffff, 0x00ffffff, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00808080, 0x00808080, 0x00808080, 
-    0x00808080, 0x00808080, 0x00808080, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00800000, 0x00800000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00000000, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x0000ffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00808080, 0x009f9f5f, 0x00ffff41, 
-    0x00ffff00, 0x00ffff41, 0x009f9f5f, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00800000, 0x00800000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffff61, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff61, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00800000, 0x00800000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffff20, 0x00ffff00, 
-    0x00ffff00, 0x00404000, 0x00ffff20, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00800000, 0x00800000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffff20, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff20, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00000000, 0x00000000, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffff61, 0x00ffff00, 
-    0x00ffff00, 0x00ffff00, 0x00ffff61, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 
-    0x00000000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x009f9f5f, 0x00ffff41, 
-    0x00ffff00, 0x00ffff41, 0x009f9f5f, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00ff00ff, 0x00ff0000, 0x00ff0000, 0x00ff0000, 0x00000000, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00808080, 0x00000000, 
-    0x00000000, 0x00000000, 0x00000000, 0x00808080, 0x00c0c0c0, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00ff00ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00ffffff, 0x00000000, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00000000, 0x00000000, 0x00c0c0c0, 0x00000000, 0x00c0c0c0, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 
-    0x00000000, 0x000000ff, 0x00000000, 0x0000ffff, 0x0000ffff, 0x00000000, 0x00000000, 0x00000000, 0x0000ffff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x00c0c0c0, 0x00c0c0c0, 0x00c0c0c0, 0x00ffffff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x00ffffff, 0x00ffffff, 0x00ff00ff, 0x00ff00ff, 0x00ff00ff, 0x00000000, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x00ffffff, 0x00ffffff, 0x00ffffff, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x00000000, 0x00000000, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-    0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x00000000, 0x0000ffff, 0x000000ff, 
-    0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 0x0000ffff, 
-    0x0000ffff, 0x0000ffff, 0x00000000, 0x0000ffff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x000000ff, 0x00000000, 
-};
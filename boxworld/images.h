@@ -29,10 +29,6 @@
 
 //-------------------------------------------------------------------------
 
-#include <vector>
-
-//-------------------------------------------------------------------------
-
 static constexpr int tileWidth = 30;
 static constexpr int tileHeight = 30;
 static constexpr int tileCount = 15;
@@ -40,16 +36,3 @@ static constexpr int tileCount = 15;
 static constexpr int batteryWidth = 14;
 static constexpr int batteryHeight = 8;
 
-//-------------------------------------------------------------------------
-
-extern std::vector<uint32_t> emptyImage;
-extern std::vector<uint32_t> passageImage;
-extern std::vector<uint32_t> boxImage;
-extern std::vector<uint32_t> playerImage;
-extern std::vector<uint32_t> wallImage;
-extern std::vector<uint32_t> passageWithTargetImage;
-extern std::vector<uint32_t> boxOnTargetImage;
-extern std::vector<uint32_t> playerOnTargetImage;
-
-extern std::vector<uint32_t> batteryImage;
-
@@ -0,0 +1,388 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <stdexcept>
+#include <system_error>
+
+#include "boxworld.h"
+#include "levelPack.h"
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+
+constexpr std::array<char, 4> indexMagic{ 'B', 'X', 'I', 'X' };
+
+}
+
+//-------------------------------------------------------------------------
+
+LevelPack::LevelPack(
+    const std::string& filename)
+:
+    m_filename{filename},
+    m_indexFilename{filename + ".idx"},
+    m_name{},
+    m_file{filename, std::ios::binary},
+    m_offsets{},
+    m_skipped{0}
+{
+    struct stat status;
+
+    if (not m_file or (::stat(filename.c_str(), &status) == -1))
+    {
+        throw std::system_error{errno,
+                                std::system_category(),
+                                "cannot open level pack " + filename};
+    }
+
+    const auto slash = filename.find_last_of('/');
+    m_name = filename.substr((slash == std::string::npos) ? 0 : slash + 1);
+    m_name = m_name.substr(0, m_name.find_last_of('.'));
+
+    if (not readIndex(status.st_size, status.st_mtime))
+    {
+        buildIndex();
+        writeIndex(status.st_size, status.st_mtime);
+    }
+
+    if (m_offsets.empty())
+    {
+        throw std::runtime_error("no levels found in " + filename);
+    }
+}
+
+//-------------------------------------------------------------------------
+
+Level::LevelType
+LevelPack::level(
+    int number)
+{
+    m_file.clear();
+    m_file.seekg(m_offsets.at(number));
+
+    std::vector<std::string> rows;
+    std::string line;
+    std::string row;
+
+    while (std::getline(m_file, line) and levelLine(line, row))
+    {
+        rows.push_back(row);
+    }
+
+    size_t width = 0;
+
+    for (const auto& row : rows)
+    {
+        width = std::max(width, row.size());
+    }
+
+    const int top = (Level::levelHeight - static_cast<int>(rows.size())) / 2;
+    const int left = (Level::levelWidth - static_cast<int>(width)) / 2;
+
+    Level::LevelType board{};
+    int playerX = 0;
+    int playerY = 0;
+
+    for (size_t j = 0 ; j < rows.size() ; ++j)
+    {
+        for (size_t i = 0 ; i < rows[j].size() ; ++i)
+        {
+            auto& piece = board[top + j][left + i];
+
+            switch (rows[j][i])
+            {
+            case '#': piece = Boxworld::WALL; break;
+            case '$': piece = Boxworld::BOX; break;
+            case '*': piece = Boxworld::BOX_ON_TARGET; break;
+            case '.': piece = Boxworld::PASSAGE_WITH_TARGET; break;
+            case '@': piece = Boxworld::PLAYER; break;
+            case '+': piece = Boxworld::PLAYER_ON_TARGER; break;
+            default: piece = Boxworld::PASSAGE; break;
+            }
+
+            if ((piece & ~Boxworld::targetMask) == Boxworld::PLAYER)
+            {
+                playerX = left + i;
+                playerY = top + j;
+            }
+        }
+    }
+
+    //---------------------------------------------------------------------
+
+    // Floor in the text is only passage if the player can get to it. The
+    // rest is outside the walls and is left empty.
+
+    std::array<std::array<bool, Level::levelWidth>, Level::levelHeight> inside{};
+    std::vector<std::pair<int, int>> stack{ { playerX, playerY } };
+    inside[playerY][playerX] = true;
+
+    while (not stack.empty())
+    {
+        const auto [x, y] = stack.back();
+        stack.pop_back();
+
+        for (const auto& [dx, dy] : { std::pair{ 0, -1 },
+                                      std::pair{ 0, 1 },
+                                      std::pair{ -1, 0 },
+                                      std::pair{ 1, 0 } })
+        {
+            const int nextX = x + dx;
+            const int nextY = y + dy;
+
+            if ((nextX >= 0) and
+                (nextY >= 0) and
+                (nextX < Level::levelWidth) and
+                (nextY < Level::levelHeight) and
+                not inside[nextY][nextX] and
+                (board[nextY][nextX] != Boxworld::EMPTY) and
+                (board[nextY][nextX] != Boxworld::WALL))
+            {
+                inside[nextY][nextX] = true;
+                stack.emplace_back(nextX, nextY);
+            }
+        }
+    }
+
+    for (int j = 0 ; j < Level::levelHeight ; ++j)
+    {
+        for (int i = 0 ; i < Level::levelWidth ; ++i)
+        {
+            if ((board[j][i] == Boxworld::PASSAGE) and not inside[j][i])
+            {
+                board[j][i] = Boxworld::EMPTY;
+            }
+        }
+    }
+
+    return board;
+}
+
+//-------------------------------------------------------------------------
+
+bool
+LevelPack::levelLine(
+    const std::string& line,
+    std::string& row)
+{
+    // A board line holds only board characters and contains a wall. Runs
+    // can be written as a count followed by the character.
+
+    row.clear();
+
+    int run = 0;
+    bool wall = false;
+
+    for (const char c : line)
+    {
+        if (std::isdigit(c))
+        {
+            run = (run * 10) + (c - '0');
+            continue;
+        }
+
+        char piece = c;
+
+        switch (c)
+        {
+        case '#':
+
+            wall = true;
+
+            break;
+
+        case '-':
+        case '_':
+
+            piece = ' ';
+
+            break;
+
+        case ' ':
+        case '$':
+        case '*':
+        case '.':
+        case '@':
+        case '+':
+
+            break;
+
+        case '\r':
+
+            continue;
+
+        default:
+
+            return false;
+        }
+
+        row.append(std::max(run, 1), piece);
+        run = 0;
+    }
+
+    while (not row.empty() and (row.back() == ' '))
+    {
+        row.pop_back();
+    }
+
+    return wall;
+}
+
+//-------------------------------------------------------------------------
+
+bool
+LevelPack::readIndex(
+    uint64_t size,
+    int64_t modified)
+{
+    std::ifstream ifs{m_indexFilename, std::ios::binary};
+
+    std::array<char, 4> magic{};
+    uint64_t indexedSize = 0;
+    int64_t indexedModified = 0;
+    uint32_t count = 0;
+
+    ifs.read(magic.data(), magic.size());
+    ifs.read(reinterpret_cast<char*>(&indexedSize), sizeof(indexedSize));
+    ifs.read(reinterpret_cast<char*>(&indexedModified), sizeof(indexedModified));
+    ifs.read(reinterpret_cast<char*>(&count), sizeof(count));
+    ifs.read(reinterpret_cast<char*>(&m_skipped), sizeof(m_skipped));
+
+    if (not ifs or
+        (magic != indexMagic) or
+        (indexedSize != size) or
+        (indexedModified != modified))
+    {
+        m_skipped = 0;
+        return false;
+    }
+
+    m_offsets.resize(count);
+    ifs.read(reinterpret_cast<char*>(m_offsets.data()),
+             count * sizeof(uint32_t));
+
+    if (not ifs)
+    {
+        m_offsets.clear();
+        m_skipped = 0;
+        return false;
+    }
+
+    return true;
+}
+
+//-------------------------------------------------------------------------
+
+void
+LevelPack::writeIndex(
+    uint64_t size,
+    int64_t modified) const
+{
+    // The index is only a cache, so a pack in a read only directory is
+    // scanned each time instead.
+
+    std::ofstream ofs{m_indexFilename, std::ios::binary};
+    const uint32_t count = m_offsets.size();
+
+    ofs.write(indexMagic.data(), indexMagic.size());
+    ofs.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    ofs.write(reinterpret_cast<const char*>(&modified), sizeof(modified));
+    ofs.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    ofs.write(reinterpret_cast<const char*>(&m_skipped), sizeof(m_skipped));
+    ofs.write(reinterpret_cast<const char*>(m_offsets.data()),
+              count * sizeof(uint32_t));
+}
+
+//-------------------------------------------------------------------------
+
+void
+LevelPack::buildIndex()
+{
+    uint32_t offset = 0;
+    uint32_t start = 0;
+    size_t width = 0;
+    int height = 0;
+    int players = 0;
+
+    auto endLevel = [&]
+    {
+        if (height > 0)
+        {
+            if ((height <= Level::levelHeight) and
+                (width <= static_cast<size_t>(Level::levelWidth)) and
+                (players == 1))
+            {
+                m_offsets.push_back(start);
+            }
+            else
+            {
+                ++m_skipped;
+            }
+        }
+
+        width = 0;
+        height = 0;
+        players = 0;
+    };
+
+    std::string line;
+    std::string row;
+
+    while (std::getline(m_file, line))
+    {
+        if (levelLine(line, row))
+        {
+            if (height == 0)
+            {
+                start = offset;
+            }
+
+            width = std::max(width, row.size());
+            players += std::count_if(row.begin(), row.end(), [](char c)
+            {
+                return (c == '@') or (c == '+');
+            });
+            ++height;
+        }
+        else
+        {
+            endLevel();
+        }
+
+        offset += line.size() + 1;
+    }
+
+    endLevel();
+}
@@ -0,0 +1,74 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "level.h"
+
+//-------------------------------------------------------------------------
+
+// A pack of levels in the standard Sokoban text (XSB or .sok) format. The
+// pack is only scanned for where each level starts, and that index is kept
+// in a file next to the pack so later runs don't scan it at all. Levels
+// are read from the pack when they are asked for. Levels of any size up to
+// the size of the board are centred on it, and larger ones are skipped.
+
+class LevelPack
+{
+public:
+
+    explicit LevelPack(const std::string& filename);
+
+    int count() const { return m_offsets.size(); }
+    int skipped() const { return m_skipped; }
+    const std::string& name() const { return m_name; }
+
+    Level::LevelType level(int number);
+
+private:
+
+    static bool levelLine(const std::string& line, std::string& row);
+
+    bool readIndex(uint64_t size, int64_t modified);
+    void writeIndex(uint64_t size, int64_t modified) const;
+    void buildIndex();
+
+    std::string m_filename;
+    std::string m_indexFilename;
+    std::string m_name;
+    std::ifstream m_file;
+    std::vector<uint32_t> m_offsets;
+    uint32_t m_skipped;
+};
@@ -31,7 +31,8 @@
 
 //-------------------------------------------------------------------------
 
-Levels::Levels()
+Levels::Levels(
+    const std::string& packFile)
 :
     m_levels{
         {
@@ -1636,13 +1637,37 @@ Levels::Levels()
                 { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }
             } })
         }
+    },
+    m_pack{}
+{
+    if (not packFile.empty())
+    {
+        m_pack = std::make_unique<LevelPack>(packFile);
     }
+}
+
+//-------------------------------------------------------------------------
+
+int Levels::count() const
+{
+    return (m_pack) ? m_pack->count() : Level::levelCount;
+}
+
+//-------------------------------------------------------------------------
+
+std::string Levels::name() const
 {
+    return (m_pack) ? m_pack->name() : "";
 }
 
 //-------------------------------------------------------------------------
 
 const Level::LevelType Levels::level(int number) const
 {
+    if (m_pack)
+    {
+        return m_pack->level(number);
+    }
+
     return m_levels[number].level();
 }
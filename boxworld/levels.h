@@ -30,8 +30,11 @@
 //-------------------------------------------------------------------------
 
 #include <array>
+#include <memory>
+#include <string>
 
 #include "level.h"
+#include "levelPack.h"
 
 //-------------------------------------------------------------------------
 
@@ -39,12 +42,17 @@ class Levels
 {
 public:
 
-    Levels();
+    // Uses the built in levels unless a level pack is given.
 
+    explicit Levels(const std::string& packFile = "");
+
+    int count() const;
+    std::string name() const;
     const Level::LevelType level(int number) const;
 
 private:
 
     const std::array<Level, Level::levelCount> m_levels;
+    std::unique_ptr<LevelPack> m_pack;
 };
 
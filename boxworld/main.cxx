@@ -30,10 +30,13 @@
 
 #include <csignal>
 #include <iostream>
-#include <thread>
+#include <memory>
 
+#include "eventLoop.h"
 #include "framebuffer8880.h"
 #include "joystick.h"
+#include "profiler.h"
+#include "profileTrace.h"
 #include "boxworld.h"
 
 //-------------------------------------------------------------------------
@@ -45,7 +48,6 @@ using namespace ogsfb32;
 
 namespace
 {
-volatile static std::sig_atomic_t run = 1;
 const char* defaultDevice = "/dev/dri/card0";
 }
 
@@ -62,6 +64,9 @@ printUsage(
     os << "    --device,-d - dri device to use";
     os << " (default is " << defaultDevice << ")\n";
     os << "    --help,-h - print usage and exit\n";
+    os << "    --levels,-l <file> - play the levels in a Sokoban level pack\n";
+    os << "    --profile,-p - show frame profile overlay\n";
+    os << "    --trace,-t <file> - write Chrome trace events to file on exit\n";
     os << "\n";
 }
 
@@ -74,14 +79,20 @@ main(
 {
     const char* device = defaultDevice;
     char* program = basename(argv[0]);
+    bool profile = false;
+    const char* traceFile = nullptr;
+    std::string levelPack;
 
     //---------------------------------------------------------------------
 
-    static const char* sopts = "d:h";
+    static const char* sopts = "d:hl:pt:";
     static struct option lopts[] = 
     {
         { "device", required_argument, nullptr, 'd' },
         { "help", no_argument, nullptr, 'h' },
+        { "levels", required_argument, nullptr, 'l' },
+        { "profile", no_argument, nullptr, 'p' },
+        { "trace", required_argument, nullptr, 't' },
         { nullptr, no_argument, nullptr, 0 }
     };
 
@@ -104,6 +115,24 @@ main(
 
             break;
 
+        case 'l':
+
+            levelPack = optarg;
+
+            break;
+
+        case 'p':
+
+            profile = true;
+
+            break;
+
+        case 't':
+
+            traceFile = optarg;
+
+            break;
+
         default:
 
             printUsage(std::cerr, program);
@@ -121,30 +150,96 @@ main(
         FrameBuffer8880 fb(device);
         fb.clear(RGB8880{0, 0, 0});
 
-        Boxworld boxworld;
+        std::unique_ptr<ProfileTrace> profileTrace;
+
+        if (profile or (traceFile != nullptr))
+        {
+            Profiler::enable();
+        }
+
+        if (profile)
+        {
+            constexpr int16_t traceHeight = 100;
+            constexpr int16_t width = 180;
+
+            profileTrace = std::make_unique<ProfileTrace>(
+                width,
+                traceHeight,
+                fb.getHeight() - traceHeight - Trace::getLegendHeight(),
+                10,
+                std::vector<std::string>{"update", "drawBoard", "drawText"},
+                std::vector<std::string>{"input", "board", "text"});
+        }
+
+        Boxworld boxworld{fb, levelPack};
         boxworld.init();
         boxworld.draw(fb);
 
         //-----------------------------------------------------------------
 
-        while (run)
+        EventLoop loop;
+
+        for (const int signalNumber : { SIGINT, SIGTERM })
         {
-            js.read();
+            loop.addSignal(signalNumber, [&loop] { loop.stop(); });
+        }
+
+        loop.addReader(js.fd(), [&js] { js.read(); });
 
+        auto frame = [&]
+        {
             if (js.buttonPressed(Joystick::BUTTON_TOP_RIGHT))
             {
-                run = 0;
+                loop.stop();
+                return;
+            }
+
+            boxworld.update(js);
+            boxworld.draw(fb);
+
+            if (profileTrace)
+            {
+                profileTrace->update(0);
+                profileTrace->show(fb);
             }
-            else
+
+            // The board, sprites, text and profile trace add damage for
+            // what they draw, so most frames have nothing to present.
+
+            if (fb.hasDamage())
             {
-                boxworld.update(js);
-                boxworld.draw(fb);
+                fb.present();
             }
+        };
 
-            std::this_thread::sleep_for(250ms);
+        // Frames are paced by the vertical blank where the driver can
+        // send an event for it, and by a timer otherwise. Between frames
+        // the process sleeps in the event loop.
+
+        if (fb.requestVblankEvent())
+        {
+            loop.addReader(fb.getFd(), [&fb, &frame]
+            {
+                if (fb.handleEvents())
+                {
+                    frame();
+                    fb.requestVblankEvent();
+                }
+            });
+        }
+        else
+        {
+            loop.addTimer(20ms, frame);
         }
 
+        loop.run();
+
         fb.clear();
+
+        if (traceFile != nullptr)
+        {
+            Profiler::writeChromeTrace(traceFile);
+        }
     }
     catch (std::exception& error)
     {
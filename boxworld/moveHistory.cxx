@@ -0,0 +1,179 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <cctype>
+#include <fstream>
+
+#include "moveHistory.h"
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+
+constexpr char letters[] = "udlr";
+constexpr uint8_t pushFlag = 0x04;
+
+}
+
+//-------------------------------------------------------------------------
+
+MoveHistory::MoveHistory()
+:
+    m_moves{},
+    m_size{0},
+    m_position{0}
+{
+}
+
+//-------------------------------------------------------------------------
+
+void
+MoveHistory::clear()
+{
+    m_moves.clear();
+    m_size = 0;
+    m_position = 0;
+}
+
+//-------------------------------------------------------------------------
+
+void
+MoveHistory::record(
+    const Move& move)
+{
+    // A new move replaces any moves that could have been redone.
+
+    m_size = m_position + 1;
+    m_moves.resize((m_size + 1) / 2);
+
+    const uint8_t code = move.direction | ((move.push) ? pushFlag : 0);
+    const int shift = (m_position % 2) * 4;
+    auto& byte = m_moves[m_position / 2];
+
+    byte = (byte & ~(0x0F << shift)) | (code << shift);
+    ++m_position;
+}
+
+//-------------------------------------------------------------------------
+
+MoveHistory::Move
+MoveHistory::undo()
+{
+    return get(--m_position);
+}
+
+//-------------------------------------------------------------------------
+
+MoveHistory::Move
+MoveHistory::redo()
+{
+    return get(m_position++);
+}
+
+//-------------------------------------------------------------------------
+
+std::string
+MoveHistory::lurd() const
+{
+    std::string moves;
+    moves.reserve(m_position);
+
+    for (size_t index = 0 ; index < m_position ; ++index)
+    {
+        const auto move = get(index);
+        const char letter = letters[move.direction];
+
+        moves += (move.push) ? std::toupper(letter) : letter;
+    }
+
+    return moves;
+}
+
+//-------------------------------------------------------------------------
+
+void
+MoveHistory::save(
+    const std::string& filename) const
+{
+    std::ofstream file{filename};
+
+    if (file)
+    {
+        file << lurd() << "\n";
+    }
+}
+
+//-------------------------------------------------------------------------
+
+bool
+MoveHistory::fromLURD(
+    char letter,
+    Move& move)
+{
+    for (int direction = UP ; direction <= RIGHT ; ++direction)
+    {
+        if (std::tolower(letter) == letters[direction])
+        {
+            move.direction = static_cast<Direction>(direction);
+            move.push = std::isupper(letter);
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//-------------------------------------------------------------------------
+
+std::string
+MoveHistory::load(
+    const std::string& filename)
+{
+    std::ifstream file{filename};
+    std::string moves;
+
+    if (file)
+    {
+        std::getline(file, moves);
+    }
+
+    return moves;
+}
+
+//-------------------------------------------------------------------------
+
+MoveHistory::Move
+MoveHistory::get(
+    size_t index) const
+{
+    const uint8_t code = (m_moves[index / 2] >> ((index % 2) * 4)) & 0x0F;
+
+    return Move{ static_cast<Direction>(code & 0x03), (code & pushFlag) != 0 };
+}
@@ -0,0 +1,89 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//-------------------------------------------------------------------------
+
+// The moves made on a level, with undo and redo. Each move is a direction
+// and a flag saying whether a box was pushed, packed into four bits. Moves
+// are saved and loaded in LURD notation, where upper case letters are
+// pushes.
+
+class MoveHistory
+{
+public:
+
+    enum Direction
+    {
+        UP = 0,
+        DOWN = 1,
+        LEFT = 2,
+        RIGHT = 3
+    };
+
+    struct Move
+    {
+        Direction direction;
+        bool push;
+    };
+
+    MoveHistory();
+
+    void clear();
+    void record(const Move& move);
+
+    bool canUndo() const { return m_position > 0; }
+    bool canRedo() const { return m_position < m_size; }
+
+    Move undo();
+    Move redo();
+
+    size_t size() const { return m_size; }
+    size_t position() const { return m_position; }
+
+    std::string lurd() const;
+    void save(const std::string& filename) const;
+
+    static bool fromLURD(char letter, Move& move);
+    static std::string load(const std::string& filename);
+
+private:
+
+    Move get(size_t index) const;
+
+    std::vector<uint8_t> m_moves;
+    size_t m_size;
+    size_t m_position;
+};
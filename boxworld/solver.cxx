@@ -0,0 +1,584 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include <cctype>
+#include <random>
+
+#include "boxworld.h"
+#include "solver.h"
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+
+//-------------------------------------------------------------------------
+
+constexpr std::array<int, 4> offsets{ -Level::levelWidth, Level::levelWidth, -1, 1 };
+constexpr std::array<char, 4> directions{ 'u', 'd', 'l', 'r' };
+constexpr uint16_t unreachable{UINT16_MAX};
+
+//-------------------------------------------------------------------------
+
+struct ZobristKeys
+{
+    ZobristKeys()
+    {
+        std::mt19937_64 generator{0x5eed};
+
+        for (int i = 0 ; i < Solver::cells ; ++i)
+        {
+            box[i] = generator();
+            player[i] = generator();
+        }
+    }
+
+    std::array<uint64_t, Solver::cells> box;
+    std::array<uint64_t, Solver::cells> player;
+};
+
+const ZobristKeys zobrist;
+
+//-------------------------------------------------------------------------
+
+}
+
+//-------------------------------------------------------------------------
+
+Solver::Solver(
+    const Level::LevelType& board,
+    size_t maxNodes)
+:
+    m_floor{},
+    m_targets{},
+    m_boxes{},
+    m_player{0},
+    m_distance{},
+    m_maxNodes{maxNodes},
+    m_nodes{},
+    m_table{}
+{
+    for (int j = 0 ; j < Level::levelHeight ; ++j)
+    {
+        for (int i = 0 ; i < Level::levelWidth ; ++i)
+        {
+            const int square = i + (j * Level::levelWidth);
+            const uint8_t piece = board[j][i];
+
+            // Squares on the edge are treated as walls, so every floor
+            // square has four neighbours on the board.
+
+            const bool edge = (i == 0) or
+                              (j == 0) or
+                              (i == Level::levelWidth - 1) or
+                              (j == Level::levelHeight - 1);
+
+            if (edge or (piece == Boxworld::EMPTY) or (piece == Boxworld::WALL))
+            {
+                continue;
+            }
+
+            m_floor.set(square);
+            m_targets[square] = (piece & Boxworld::targetMask) != 0;
+
+            switch (piece & ~Boxworld::targetMask)
+            {
+            case Boxworld::BOX:
+
+                m_boxes.set(square);
+
+                break;
+
+            case Boxworld::PLAYER:
+
+                m_player = square;
+
+                break;
+
+            default:
+
+                break;
+            }
+        }
+    }
+
+    //---------------------------------------------------------------------
+
+    // Pull a box back from every target to find the fewest pushes needed
+    // to get a box from each square to a target, ignoring other boxes.
+    // Boxes can never be moved off squares that remain unreachable.
+
+    m_distance.fill(unreachable);
+
+    std::vector<int> queue;
+
+    for (int square = 0 ; square < cells ; ++square)
+    {
+        if (m_targets[square])
+        {
+            m_distance[square] = 0;
+            queue.push_back(square);
+        }
+    }
+
+    for (size_t head = 0 ; head < queue.size() ; ++head)
+    {
+        const int box = queue[head];
+
+        for (const int offset : offsets)
+        {
+            const int next = box + offset;
+
+            if (m_floor[next] and
+                m_floor[next + offset] and
+                (m_distance[next] == unreachable))
+            {
+                m_distance[next] = m_distance[box] + 1;
+                queue.push_back(next);
+            }
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+
+uint8_t
+Solver::reachable(
+    int start,
+    const Squares& boxes,
+    Squares& reach) const
+{
+    std::array<uint8_t, cells> stack;
+    int top = 0;
+    int lowest = start;
+
+    reach.reset();
+    reach.set(start);
+    stack[top++] = start;
+
+    while (top > 0)
+    {
+        const int square = stack[--top];
+
+        for (const int offset : offsets)
+        {
+            const int next = square + offset;
+
+            if (m_floor[next] and not boxes[next] and not reach[next])
+            {
+                reach.set(next);
+                stack[top++] = next;
+                lowest = std::min(lowest, next);
+            }
+        }
+    }
+
+    return lowest;
+}
+
+//-------------------------------------------------------------------------
+
+bool
+Solver::frozen(
+    int square,
+    const Squares& boxes,
+    Squares& walls,
+    bool& offTarget) const
+{
+    // While looking at the neighbours the box is treated as a wall, which
+    // stops boxes that block each other from recursing forever.
+
+    walls.set(square);
+
+    bool result = true;
+
+    for (const int offset : { 1, Level::levelWidth })
+    {
+        const int before = square - offset;
+        const int after = square + offset;
+
+        auto wall = [this, &walls](int next)
+        {
+            return walls[next] or not m_floor[next];
+        };
+
+        auto dead = [this](int next)
+        {
+            return m_distance[next] == unreachable;
+        };
+
+        const bool blocked =
+            wall(before) or
+            wall(after) or
+            (dead(before) and dead(after)) or
+            (boxes[before] and frozen(before, boxes, walls, offTarget)) or
+            (boxes[after] and frozen(after, boxes, walls, offTarget));
+
+        if (not blocked)
+        {
+            result = false;
+            break;
+        }
+    }
+
+    walls.reset(square);
+
+    if (result and not m_targets[square])
+    {
+        offTarget = true;
+    }
+
+    return result;
+}
+
+//-------------------------------------------------------------------------
+
+bool
+Solver::deadlocked(
+    const Squares& boxes,
+    int square) const
+{
+    // A box that can no longer move along either axis is frozen. It is a
+    // deadlock if it, or any box freezing it, is not on a target.
+
+    Squares walls;
+    bool offTarget = false;
+
+    return frozen(square, boxes, walls, offTarget) and offTarget;
+}
+
+//-------------------------------------------------------------------------
+
+int
+Solver::heuristic(
+    const Squares& boxes) const
+{
+    int estimate = 0;
+
+    for (int square = 0 ; square < cells ; ++square)
+    {
+        if (boxes[square])
+        {
+            if (m_distance[square] == unreachable)
+            {
+                return -1;
+            }
+
+            estimate += m_distance[square];
+        }
+    }
+
+    return estimate;
+}
+
+//-------------------------------------------------------------------------
+
+uint32_t
+Solver::find(
+    const Node& node,
+    uint64_t hash,
+    bool& found)
+{
+    const size_t mask = m_table.size() - 1;
+    size_t slot = hash & mask;
+
+    while (m_table[slot] != 0)
+    {
+        const uint32_t index = m_table[slot] - 1;
+        const Node& other = m_nodes[index];
+
+        if ((other.boxHash == node.boxHash) and
+            (other.player == node.player) and
+            (other.boxes == node.boxes))
+        {
+            found = true;
+            return index;
+        }
+
+        slot = (slot + 1) & mask;
+    }
+
+    found = false;
+    m_nodes.push_back(node);
+    m_table[slot] = m_nodes.size();
+
+    return m_nodes.size() - 1;
+}
+
+//-------------------------------------------------------------------------
+
+Solver::Result
+Solver::solve(
+    const std::atomic<bool>* cancel)
+{
+    Result result{false, false, "", 0, 0};
+
+    const int estimate = heuristic(m_boxes);
+
+    if (estimate < 0)
+    {
+        return result;
+    }
+
+    size_t tableSize = 1;
+
+    while (tableSize < (2 * m_maxNodes))
+    {
+        tableSize *= 2;
+    }
+
+    m_nodes.clear();
+    m_nodes.reserve(m_maxNodes);
+    m_table.assign(tableSize, 0);
+
+    Squares reach;
+    Squares childReach;
+    uint64_t boxHash = 0;
+
+    for (int square = 0 ; square < cells ; ++square)
+    {
+        if (m_boxes[square])
+        {
+            boxHash ^= zobrist.box[square];
+        }
+    }
+
+    Node root
+    {
+        m_boxes,
+        boxHash,
+        noParent,
+        0,
+        static_cast<uint16_t>(estimate),
+        reachable(m_player, m_boxes, reach),
+        0,
+        0
+    };
+
+    bool found = false;
+    find(root, root.boxHash ^ zobrist.player[root.player], found);
+
+    // Nodes to expand are kept in buckets by estimated total pushes.
+
+    std::vector<std::vector<uint32_t>> open(estimate + 1);
+    open[estimate].push_back(0);
+
+    for (size_t bucket = estimate ; bucket < open.size() ; )
+    {
+        if (open[bucket].empty())
+        {
+            ++bucket;
+            continue;
+        }
+
+        if ((cancel != nullptr) and cancel->load(std::memory_order_relaxed))
+        {
+            break;
+        }
+
+        const uint32_t index = open[bucket].back();
+        open[bucket].pop_back();
+
+        const Node node = m_nodes[index];
+
+        if ((node.pushes + node.estimate) != bucket)
+        {
+            continue;
+        }
+
+        if ((node.boxes & ~m_targets).none())
+        {
+            result.solved = true;
+            result.moves = moves(index);
+            result.pushes = node.pushes;
+            break;
+        }
+
+        reachable(node.player, node.boxes, reach);
+
+        for (int square = 0 ; square < cells ; ++square)
+        {
+            if (not reach[square])
+            {
+                continue;
+            }
+
+            for (int direction = 0 ; direction < 4 ; ++direction)
+            {
+                const int box = square + offsets[direction];
+                const int to = box + offsets[direction];
+
+                if (not node.boxes[box] or
+                    not m_floor[to] or
+                    node.boxes[to] or
+                    (m_distance[to] == unreachable))
+                {
+                    continue;
+                }
+
+                Node child = node;
+
+                child.boxes.reset(box);
+                child.boxes.set(to);
+
+                if (deadlocked(child.boxes, to))
+                {
+                    continue;
+                }
+
+                child.boxHash ^= zobrist.box[box] ^ zobrist.box[to];
+                child.parent = index;
+                child.pushes = node.pushes + 1;
+                child.estimate = node.estimate - m_distance[box] + m_distance[to];
+                child.player = reachable(box, child.boxes, childReach);
+                child.from = box;
+                child.direction = direction;
+
+                if (m_nodes.size() >= m_maxNodes)
+                {
+                    result.exhausted = true;
+                    result.nodes = m_nodes.size();
+
+                    return result;
+                }
+
+                const uint32_t childIndex =
+                    find(child, child.boxHash ^ zobrist.player[child.player], found);
+
+                if (found)
+                {
+                    Node& other = m_nodes[childIndex];
+
+                    if (child.pushes >= other.pushes)
+                    {
+                        continue;
+                    }
+
+                    other.parent = child.parent;
+                    other.pushes = child.pushes;
+                    other.from = child.from;
+                    other.direction = child.direction;
+                }
+
+                const size_t total = child.pushes + child.estimate;
+
+                if (open.size() <= total)
+                {
+                    open.resize(total + 1);
+                }
+
+                open[total].push_back(childIndex);
+            }
+        }
+    }
+
+    result.nodes = m_nodes.size();
+
+    return result;
+}
+
+//-------------------------------------------------------------------------
+
+std::string
+Solver::path(
+    int from,
+    int to,
+    const Squares& boxes) const
+{
+    std::array<int8_t, cells> via;
+    std::vector<int> queue{from};
+
+    via.fill(-1);
+
+    for (size_t head = 0 ; (head < queue.size()) and (via[to] == -1) ; ++head)
+    {
+        const int square = queue[head];
+
+        for (int direction = 0 ; direction < 4 ; ++direction)
+        {
+            const int next = square + offsets[direction];
+
+            if (m_floor[next] and
+                not boxes[next] and
+                (next != from) and
+                (via[next] == -1))
+            {
+                via[next] = direction;
+                queue.push_back(next);
+            }
+        }
+    }
+
+    std::string steps;
+
+    for (int square = to ; square != from ; square -= offsets[via[square]])
+    {
+        steps += directions[via[square]];
+    }
+
+    std::reverse(steps.begin(), steps.end());
+
+    return steps;
+}
+
+//-------------------------------------------------------------------------
+
+std::string
+Solver::moves(
+    uint32_t goal) const
+{
+    std::vector<uint32_t> pushes;
+
+    for (uint32_t index = goal ; m_nodes[index].parent != noParent ; index = m_nodes[index].parent)
+    {
+        pushes.push_back(index);
+    }
+
+    std::reverse(pushes.begin(), pushes.end());
+
+    Squares boxes = m_boxes;
+    int player = m_player;
+    std::string result;
+
+    for (const uint32_t index : pushes)
+    {
+        const Node& node = m_nodes[index];
+        const int offset = offsets[node.direction];
+
+        result += path(player, node.from - offset, boxes);
+        result += std::toupper(directions[node.direction]);
+
+        boxes.reset(node.from);
+        boxes.set(node.from + offset);
+        player = node.from;
+    }
+
+    return result;
+}
+
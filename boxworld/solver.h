@@ -0,0 +1,111 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <array>
+#include <atomic>
+#include <bitset>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "level.h"
+
+//-------------------------------------------------------------------------
+
+// A push optimal Sokoban solver. It is an A* search over pushes, where a
+// state is the set of box squares plus the top left square the player can
+// reach. Squares from which a box can never reach a target are pruned, as
+// are pushes that freeze a box that is not on a target. The solution is in
+// LURD notation: lower case letters are player moves and upper case
+// letters are pushes.
+
+class Solver
+{
+public:
+
+    static constexpr int cells = Level::levelWidth * Level::levelHeight;
+    static constexpr size_t defaultMaxNodes{1000000};
+
+    using Squares = std::bitset<cells>;
+
+    // nodes is the number of positions stored, which is what maxNodes
+    // limits. exhausted is set if the search stopped at that limit, in
+    // which case there may still be a solution.
+
+    struct Result
+    {
+        bool solved;
+        bool exhausted;
+        std::string moves;
+        int pushes;
+        uint64_t nodes;
+    };
+
+    explicit Solver(const Level::LevelType& board, size_t maxNodes = defaultMaxNodes);
+
+    Result solve(const std::atomic<bool>* cancel = nullptr);
+
+private:
+
+    struct Node
+    {
+        Squares boxes;
+        uint64_t boxHash;
+        uint32_t parent;
+        uint16_t pushes;
+        uint16_t estimate;
+        uint8_t player;
+        uint8_t from;
+        uint8_t direction;
+    };
+
+    static constexpr uint32_t noParent{UINT32_MAX};
+
+    uint8_t reachable(int start, const Squares& boxes, Squares& reach) const;
+    bool frozen(int square, const Squares& boxes, Squares& walls, bool& offTarget) const;
+    bool deadlocked(const Squares& boxes, int square) const;
+    int heuristic(const Squares& boxes) const;
+    uint32_t find(const Node& node, uint64_t hash, bool& found);
+    std::string path(int from, int to, const Squares& boxes) const;
+    std::string moves(uint32_t goal) const;
+
+    Squares m_floor;
+    Squares m_targets;
+    Squares m_boxes;
+    int m_player;
+    std::array<uint16_t, cells> m_distance;
+
+    size_t m_maxNodes;
+    std::vector<Node> m_nodes;
+    std::vector<uint32_t> m_table;
+};
+
@@ -0,0 +1,186 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "allocationCounter.h"
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+
+//-------------------------------------------------------------------------
+
+std::atomic<uint64_t> allocationCount{0};
+
+//-------------------------------------------------------------------------
+
+void*
+allocate(
+    size_t size,
+    size_t alignment)
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+    if (size == 0)
+    {
+        size = 1;
+    }
+
+    // aligned_alloc wants the size to be a multiple of the alignment.
+
+    size = ((size + alignment - 1) / alignment) * alignment;
+
+    for (;;)
+    {
+        void* pointer = (alignment > alignof(std::max_align_t))
+                      ? std::aligned_alloc(alignment, size)
+                      : std::malloc(size);
+
+        if (pointer != nullptr)
+        {
+            return pointer;
+        }
+
+        const auto handler = std::get_new_handler();
+
+        if (handler == nullptr)
+        {
+            throw std::bad_alloc{};
+        }
+
+        handler();
+    }
+}
+
+//-------------------------------------------------------------------------
+
+}
+
+//-------------------------------------------------------------------------
+
+// The array and nothrow forms of new and delete are implemented by the
+// standard library in terms of these.
+
+void*
+operator new(
+    size_t size)
+{
+    return allocate(size, alignof(std::max_align_t));
+}
+
+//-------------------------------------------------------------------------
+
+void*
+operator new(
+    size_t size,
+    std::align_val_t alignment)
+{
+    return allocate(size, static_cast<size_t>(alignment));
+}
+
+//-------------------------------------------------------------------------
+
+void
+operator delete(
+    void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+//-------------------------------------------------------------------------
+
+void
+operator delete(
+    void* pointer,
+    size_t) noexcept
+{
+    std::free(pointer);
+}
+
+//-------------------------------------------------------------------------
+
+void
+operator delete(
+    void* pointer,
+    std::align_val_t) noexcept
+{
+    std::free(pointer);
+}
+
+//-------------------------------------------------------------------------
+
+void
+operator delete(
+    void* pointer,
+    size_t,
+    std::align_val_t) noexcept
+{
+    std::free(pointer);
+}
+
+//=========================================================================
+
+ogsfb32::AllocationCounter:: AllocationCounter()
+:
+    m_last{allocations()},
+    m_frames{0},
+    m_allocatingFrames{0}
+{
+}
+
+//-------------------------------------------------------------------------
+
+uint64_t
+ogsfb32::AllocationCounter:: allocations()
+{
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+//-------------------------------------------------------------------------
+
+uint64_t
+ogsfb32::AllocationCounter:: endFrame()
+{
+    const uint64_t count = allocations();
+    const uint64_t allocated = count - m_last;
+
+    if ((m_frames > 0) and (allocated > 0))
+    {
+        ++m_allocatingFrames;
+    }
+
+    m_last = count;
+    ++m_frames;
+
+    return allocated;
+}
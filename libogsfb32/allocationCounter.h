@@ -0,0 +1,73 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <cstdint>
+
+//-------------------------------------------------------------------------
+
+namespace ogsfb32
+{
+
+//-------------------------------------------------------------------------
+
+// Counts calls to the global operator new, to check that a render loop
+// does not allocate once it is running. Using it links in replacements
+// for operator new and delete, so a program that never mentions it is not
+// affected. Allocations made inside C libraries, such as libdrm, are not
+// seen.
+
+class AllocationCounter
+{
+public:
+
+    AllocationCounter();
+
+    static uint64_t allocations();
+
+    // Returns the allocations since the last frame ended. The first frame
+    // is not counted as allocating, as buffers grow to size in it.
+
+    uint64_t endFrame();
+
+    uint64_t getFrames() const { return m_frames; }
+    uint64_t getAllocatingFrames() const { return m_allocatingFrames; }
+
+private:
+
+    uint64_t m_last;
+    uint64_t m_frames;
+    uint64_t m_allocatingFrames;
+};
+
+//-------------------------------------------------------------------------
+
+} // namespace ogsfb32
@@ -0,0 +1,87 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include "animation.h"
+
+//-------------------------------------------------------------------------
+
+ogsfb32::Animation:: Animation()
+:
+    Animation({ { 0, std::chrono::milliseconds{1} } })
+{
+}
+
+//-------------------------------------------------------------------------
+
+ogsfb32::Animation:: Animation(
+    const std::vector<Frame>& frames,
+    bool loop)
+:
+    m_frames(frames),
+    m_length{0},
+    m_loop{loop}
+{
+    for (const auto& frame : m_frames)
+    {
+        m_length += frame.duration;
+    }
+}
+
+//-------------------------------------------------------------------------
+
+uint8_t
+ogsfb32::Animation:: frameAt(
+    std::chrono::milliseconds elapsed) const
+{
+    if (m_frames.empty())
+    {
+        return 0;
+    }
+
+    if (elapsed >= m_length)
+    {
+        if (not m_loop or (m_length.count() == 0))
+        {
+            return m_frames.back().frame;
+        }
+
+        elapsed %= m_length;
+    }
+
+    for (const auto& frame : m_frames)
+    {
+        if (elapsed < frame.duration)
+        {
+            return frame.frame;
+        }
+
+        elapsed -= frame.duration;
+    }
+
+    return m_frames.back().frame;
+}
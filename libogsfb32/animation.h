@@ -0,0 +1,74 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+//-------------------------------------------------------------------------
+
+namespace ogsfb32
+{
+
+//-------------------------------------------------------------------------
+
+// A sequence of image frames, each shown for its own duration. The frame
+// to show is worked out from the time since the animation started, so it
+// runs at the same speed whatever the frame rate.
+
+class Animation
+{
+public:
+
+    struct Frame
+    {
+        uint8_t frame;
+        std::chrono::milliseconds duration;
+    };
+
+    Animation();
+    explicit Animation(const std::vector<Frame>& frames, bool loop = true);
+
+    std::chrono::milliseconds getLength() const { return m_length; }
+
+    uint8_t frameAt(std::chrono::milliseconds elapsed) const;
+
+private:
+
+    std::vector<Frame> m_frames;
+    std::chrono::milliseconds m_length;
+    bool m_loop;
+};
+
+//-------------------------------------------------------------------------
+
+} // namespace ogsfb32
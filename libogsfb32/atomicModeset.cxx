@@ -0,0 +1,366 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <xf86drm.h>
+#include <xf86drmMode.h>
+
+#include <cerrno>
+#include <memory>
+#include <stdexcept>
+#include <system_error>
+
+#include "atomicModeset.h"
+#include "drmUtil.h"
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+
+using drmModeAtomicReq_ptr = std::unique_ptr<drmModeAtomicReq, decltype(&drmModeAtomicFree)>;
+
+drmModeAtomicReq_ptr
+atomicAlloc()
+{
+    return drmModeAtomicReq_ptr(drmModeAtomicAlloc(), &drmModeAtomicFree);
+}
+
+}
+
+//-------------------------------------------------------------------------
+
+ogsfb32::AtomicModeset:: AtomicModeset(
+    const FileDescriptor& fd,
+    uint32_t connectorId,
+    uint32_t crtcId,
+    uint32_t primaryPlaneId)
+:
+    m_fd(fd),
+    m_connectorId{connectorId},
+    m_crtcId{crtcId},
+    m_primaryPlaneId{primaryPlaneId},
+    m_primary{},
+    m_properties(),
+    m_staged(),
+    m_damage(),
+    m_modeBlob{0},
+    m_pending{false},
+    m_flips{0},
+    m_flipTime{}
+{
+    if (drmSetClientCap(m_fd.fd(), DRM_CLIENT_CAP_ATOMIC, 1) != 0)
+    {
+        throw std::system_error{errno,
+                                std::system_category(),
+                                "no DRM atomic modesetting"};
+    }
+
+    if ((property(m_connectorId, DRM_MODE_OBJECT_CONNECTOR, "CRTC_ID") == 0) or
+        (property(m_crtcId, DRM_MODE_OBJECT_CRTC, "MODE_ID") == 0) or
+        (property(m_crtcId, DRM_MODE_OBJECT_CRTC, "ACTIVE") == 0) or
+        (property(m_primaryPlaneId, DRM_MODE_OBJECT_PLANE, "FB_ID") == 0))
+    {
+        throw std::runtime_error("DRM driver is missing atomic properties");
+    }
+}
+
+//-------------------------------------------------------------------------
+
+ogsfb32::AtomicModeset:: ~AtomicModeset()
+{
+    if (m_modeBlob != 0)
+    {
+        drmModeDestroyPropertyBlob(m_fd.fd(), m_modeBlob);
+    }
+}
+
+//-------------------------------------------------------------------------
+
+bool
+ogsfb32::AtomicModeset:: modeset(
+    const drmModeModeInfo& mode,
+    uint32_t fbId,
+    uint32_t width,
+    uint32_t height)
+{
+    uint32_t modeBlob = 0;
+
+    if (drmModeCreatePropertyBlob(m_fd.fd(), &mode, sizeof(mode), &modeBlob) != 0)
+    {
+        return false;
+    }
+
+    const PlaneState primary{ m_crtcId,
+                              fbId,
+                              0,
+                              0,
+                              width,
+                              height,
+                              0,
+                              0,
+                              width << 16,
+                              height << 16 };
+
+    auto request = atomicAlloc();
+
+    bool ok =
+        (drmModeAtomicAddProperty(request.get(),
+                                  m_connectorId,
+                                  property(m_connectorId, DRM_MODE_OBJECT_CONNECTOR, "CRTC_ID"),
+                                  m_crtcId) >= 0) and
+        (drmModeAtomicAddProperty(request.get(),
+                                  m_crtcId,
+                                  property(m_crtcId, DRM_MODE_OBJECT_CRTC, "MODE_ID"),
+                                  modeBlob) >= 0) and
+        (drmModeAtomicAddProperty(request.get(),
+                                  m_crtcId,
+                                  property(m_crtcId, DRM_MODE_OBJECT_CRTC, "ACTIVE"),
+                                  1) >= 0) and
+        addPlane(request.get(), m_primaryPlaneId, primary);
+
+    ok = ok and
+         (drmModeAtomicCommit(m_fd.fd(),
+                              request.get(),
+                              DRM_MODE_ATOMIC_TEST_ONLY | DRM_MODE_ATOMIC_ALLOW_MODESET,
+                              nullptr) == 0) and
+         (drmModeAtomicCommit(m_fd.fd(),
+                              request.get(),
+                              DRM_MODE_ATOMIC_ALLOW_MODESET,
+                              nullptr) == 0);
+
+    if (not ok)
+    {
+        drmModeDestroyPropertyBlob(m_fd.fd(), modeBlob);
+        return false;
+    }
+
+    if (m_modeBlob != 0)
+    {
+        drmModeDestroyPropertyBlob(m_fd.fd(), m_modeBlob);
+    }
+
+    m_modeBlob = modeBlob;
+    m_primary = primary;
+
+    return true;
+}
+
+//-------------------------------------------------------------------------
+
+bool
+ogsfb32::AtomicModeset:: testPlane(
+    uint32_t planeId,
+    const PlaneState& state)
+{
+    auto request = atomicAlloc();
+
+    bool ok = addPlane(request.get(), m_primaryPlaneId, m_primary);
+
+    for (const auto& [id, staged] : m_staged)
+    {
+        if (id != planeId)
+        {
+            ok = ok and addPlane(request.get(), id, staged);
+        }
+    }
+
+    ok = ok and addPlane(request.get(), planeId, state);
+
+    return ok and
+           (drmModeAtomicCommit(m_fd.fd(),
+                                request.get(),
+                                DRM_MODE_ATOMIC_TEST_ONLY,
+                                nullptr) == 0);
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::AtomicModeset:: stagePlane(
+    uint32_t planeId,
+    const PlaneState& state)
+{
+    for (auto& [id, staged] : m_staged)
+    {
+        if (id == planeId)
+        {
+            staged = state;
+            return;
+        }
+    }
+
+    m_staged.emplace_back(planeId, state);
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::AtomicModeset:: addDamage(
+    const struct drm_mode_rect& rect)
+{
+    m_damage.push_back(rect);
+}
+
+//-------------------------------------------------------------------------
+
+bool
+ogsfb32::AtomicModeset:: commit()
+{
+    if (m_pending or (m_staged.empty() and m_damage.empty()))
+    {
+        return false;
+    }
+
+    // The primary plane is always in the commit, so that the CRTC is too
+    // and a page flip event is sent.
+
+    auto request = atomicAlloc();
+
+    bool ok = addPlane(request.get(), m_primaryPlaneId, m_primary);
+
+    for (const auto& [id, staged] : m_staged)
+    {
+        ok = ok and addPlane(request.get(), id, staged);
+    }
+
+    uint32_t damageBlob = 0;
+    const uint32_t damageProperty = property(m_primaryPlaneId,
+                                             DRM_MODE_OBJECT_PLANE,
+                                             "FB_DAMAGE_CLIPS");
+
+    if (ok and not m_damage.empty() and (damageProperty != 0) and
+        (drmModeCreatePropertyBlob(m_fd.fd(),
+                                   m_damage.data(),
+                                   m_damage.size() * sizeof(struct drm_mode_rect),
+                                   &damageBlob) == 0))
+    {
+        ok = drmModeAtomicAddProperty(request.get(),
+                                      m_primaryPlaneId,
+                                      damageProperty,
+                                      damageBlob) >= 0;
+    }
+
+    const int result = (ok)
+                     ? drmModeAtomicCommit(m_fd.fd(),
+                                           request.get(),
+                                           DRM_MODE_ATOMIC_NONBLOCK | DRM_MODE_PAGE_FLIP_EVENT,
+                                           this)
+                     : -1;
+    const int error = errno;
+
+    // The commit holds its own reference to the blob.
+
+    if (damageBlob != 0)
+    {
+        drmModeDestroyPropertyBlob(m_fd.fd(), damageBlob);
+    }
+
+    if ((result != 0) and (error == EBUSY))
+    {
+        return false;
+    }
+
+    m_staged.clear();
+    m_damage.clear();
+    m_pending = (result == 0);
+
+    return m_pending;
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::AtomicModeset:: handleFlip(
+    void* data,
+    std::chrono::steady_clock::time_point time)
+{
+    auto atomic = static_cast<AtomicModeset*>(data);
+
+    atomic->m_pending = false;
+    ++(atomic->m_flips);
+    atomic->m_flipTime = time;
+}
+
+//-------------------------------------------------------------------------
+
+uint32_t
+ogsfb32::AtomicModeset:: property(
+    uint32_t objectId,
+    uint32_t objectType,
+    const std::string& name)
+{
+    const auto key = std::make_pair(objectId, name);
+    const auto found = m_properties.find(key);
+
+    if (found != m_properties.end())
+    {
+        return found->second;
+    }
+
+    const uint32_t id = drm::drmGetPropertyId(m_fd, objectId, objectType, name);
+    m_properties[key] = id;
+
+    return id;
+}
+
+//-------------------------------------------------------------------------
+
+bool
+ogsfb32::AtomicModeset:: addPlane(
+    drmModeAtomicReqPtr request,
+    uint32_t planeId,
+    const PlaneState& state)
+{
+    auto add = [this, request, planeId](const char* name, uint64_t value)
+    {
+        const uint32_t id = property(planeId, DRM_MODE_OBJECT_PLANE, name);
+
+        return (id != 0) and
+               (drmModeAtomicAddProperty(request, planeId, id, value) >= 0);
+    };
+
+    if (state.fbId == 0)
+    {
+        return add("FB_ID", 0) and add("CRTC_ID", 0);
+    }
+
+    // Negative positions are passed as two's complement, as the kernel
+    // expects for the signed CRTC_X and CRTC_Y.
+
+    return add("FB_ID", state.fbId) and
+           add("CRTC_ID", state.crtcId) and
+           add("CRTC_X", static_cast<uint64_t>(static_cast<int64_t>(state.x))) and
+           add("CRTC_Y", static_cast<uint64_t>(static_cast<int64_t>(state.y))) and
+           add("CRTC_W", state.width) and
+           add("CRTC_H", state.height) and
+           add("SRC_X", state.sourceX) and
+           add("SRC_Y", state.sourceY) and
+           add("SRC_W", state.sourceWidth) and
+           add("SRC_H", state.sourceHeight);
+}
+
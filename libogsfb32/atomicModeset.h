@@ -0,0 +1,153 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <xf86drmMode.h>
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "fileDescriptor.h"
+
+//-------------------------------------------------------------------------
+
+namespace ogsfb32
+{
+
+//-------------------------------------------------------------------------
+
+// Atomic modesetting for one connector, CRTC and primary plane.
+//
+// Plane changes and damage rectangles are staged, then sent together by
+// commit() as one non-blocking commit, so they all take effect at the
+// same vertical blank. The commit asks for a page flip event, which is
+// handed to handleFlip() by the event handler. The flips are counted and
+// the time of the last is kept, on CLOCK_MONOTONIC, as the time the
+// committed changes reached the screen. A new configuration of
+// planes can be checked with a TEST_ONLY commit before it is staged.
+
+class AtomicModeset
+{
+public:
+
+    struct PlaneState
+    {
+        uint32_t crtcId;
+        uint32_t fbId;
+        int32_t x;
+        int32_t y;
+        uint32_t width;
+        uint32_t height;
+        uint32_t sourceX;
+        uint32_t sourceY;
+        uint32_t sourceWidth;
+        uint32_t sourceHeight;
+    };
+
+    // Throws if the driver does not support atomic modesetting.
+
+    AtomicModeset(
+        const FileDescriptor& fd,
+        uint32_t connectorId,
+        uint32_t crtcId,
+        uint32_t primaryPlaneId);
+
+    ~AtomicModeset();
+
+    AtomicModeset(const AtomicModeset&) = delete;
+    AtomicModeset& operator=(const AtomicModeset&) = delete;
+
+    // Sets the mode and shows fbId on the primary plane. Blocks until it
+    // is done. Returns false if the driver rejects it.
+
+    bool
+    modeset(
+        const drmModeModeInfo& mode,
+        uint32_t fbId,
+        uint32_t width,
+        uint32_t height);
+
+    // A plane with a zero fbId is disabled.
+
+    bool testPlane(uint32_t planeId, const PlaneState& state);
+    void stagePlane(uint32_t planeId, const PlaneState& state);
+    void addDamage(const struct drm_mode_rect& rect);
+
+    // Returns false if nothing was staged, or the previous commit has not
+    // completed; anything staged is kept for the next commit.
+
+    bool commit();
+    bool isPending() const { return m_pending; }
+
+    uint32_t getFlips() const { return m_flips; }
+    std::chrono::steady_clock::time_point getFlipTime() const { return m_flipTime; }
+
+    static void
+    handleFlip(
+        void* data,
+        std::chrono::steady_clock::time_point time);
+
+private:
+
+    uint32_t
+    property(
+        uint32_t objectId,
+        uint32_t objectType,
+        const std::string& name);
+
+    bool addPlane(drmModeAtomicReqPtr request, uint32_t planeId, const PlaneState& state);
+
+    const FileDescriptor& m_fd;
+    uint32_t m_connectorId;
+    uint32_t m_crtcId;
+    uint32_t m_primaryPlaneId;
+    PlaneState m_primary;
+
+    std::map<std::pair<uint32_t, std::string>, uint32_t> m_properties;
+    // Kept in a vector, rather than a map, so that staging the same planes
+    // every frame reuses its memory.
+
+    std::vector<std::pair<uint32_t, PlaneState>> m_staged;
+    std::vector<struct drm_mode_rect> m_damage;
+    uint32_t m_modeBlob;
+    bool m_pending;
+    uint32_t m_flips;
+    std::chrono::steady_clock::time_point m_flipTime;
+};
+
+//-------------------------------------------------------------------------
+
+} // namespace ogsfb32
+
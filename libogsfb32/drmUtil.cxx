@@ -31,7 +31,7 @@
 
 drm::drmModeConnector_ptr
 drm::drmModeGetConnector(
-    ogsfb32::FileDescriptor& fd,
+    const ogsfb32::FileDescriptor& fd,
     uint32_t connId)
 {
     return drmModeConnector_ptr(::drmModeGetConnector(fd.fd(), connId),
@@ -42,7 +42,7 @@ drm::drmModeGetConnector(
 
 drm::drmModeCrtc_ptr
 drm::drmModeGetCrtc(
-    ogsfb32::FileDescriptor& fd,
+    const ogsfb32::FileDescriptor& fd,
     uint32_t crtcId)
 {
     return drmModeCrtc_ptr(::drmModeGetCrtc(fd.fd(), crtcId),
@@ -53,7 +53,7 @@ drm::drmModeGetCrtc(
 
 drm::drmModeEncoder_ptr
 drm::drmModeGetEncoder(
-    ogsfb32::FileDescriptor& fd,
+    const ogsfb32::FileDescriptor& fd,
     uint32_t encoderId)
 {
     return drmModeEncoder_ptr(::drmModeGetEncoder(fd.fd(), encoderId),
@@ -64,7 +64,7 @@ drm::drmModeGetEncoder(
 
 drm::drmModeObjectProperties_ptr
 drm::drmModeObjectGetProperties(
-    ogsfb32::FileDescriptor& fd,
+    const ogsfb32::FileDescriptor& fd,
     uint32_t objectId,
     uint32_t objectType)
 {
@@ -76,7 +76,7 @@ drm::drmModeObjectGetProperties(
 
 drm::drmModePlane_ptr
 drm::drmModeGetPlane(
-    ogsfb32::FileDescriptor& fd,
+    const ogsfb32::FileDescriptor& fd,
     uint32_t planeId)
 {
     return drmModePlane_ptr(::drmModeGetPlane(fd.fd(), planeId),
@@ -87,7 +87,7 @@ drm::drmModeGetPlane(
 
 drm::drmModePlaneRes_ptr
 drm::drmModeGetPlaneResources(
-    ogsfb32::FileDescriptor& fd)
+    const ogsfb32::FileDescriptor& fd)
 {
     return drmModePlaneRes_ptr(::drmModeGetPlaneResources(fd.fd()),
                                &drmModeFreePlaneResources);
@@ -97,7 +97,7 @@ drm::drmModeGetPlaneResources(
 
 drm::drmModePropertyRes_ptr
 drm::drmModeGetProperty(
-    ogsfb32::FileDescriptor& fd,
+    const ogsfb32::FileDescriptor& fd,
     uint32_t propertyId)
 {
     return drmModePropertyRes_ptr(::drmModeGetProperty(fd.fd(), propertyId),
@@ -108,7 +108,7 @@ drm::drmModeGetProperty(
 
 drm::drmModeRes_ptr
 drm::drmModeGetResources(
-    ogsfb32::FileDescriptor& fd)
+    const ogsfb32::FileDescriptor& fd)
 {
     return drmModeRes_ptr(::drmModeGetResources(fd.fd()),
                           &drmModeFreeResources);
@@ -118,7 +118,7 @@ drm::drmModeGetResources(
 
 uint64_t
 drm::drmGetPropertyValue(
-    ogsfb32::FileDescriptor& fd,
+    const ogsfb32::FileDescriptor& fd,
     uint32_t objectId,
     uint32_t objectType,
     const std::string& name)
@@ -138,3 +138,32 @@ drm::drmGetPropertyValue(
     return ~0;
 }
 
+//-------------------------------------------------------------------------
+
+uint32_t
+drm::drmGetPropertyId(
+    const ogsfb32::FileDescriptor& fd,
+    uint32_t objectId,
+    uint32_t objectType,
+    const std::string& name)
+{
+    auto properties = drmModeObjectGetProperties(fd, objectId, objectType);
+
+    if (not properties)
+    {
+        return 0;
+    }
+
+    for (uint32_t i = 0; i < properties->count_props; ++i)
+    {
+        auto property = drmModeGetProperty(fd, properties->props[i]);
+
+        if (property and (name == property->name))
+        {
+            return property->prop_id;
+        }
+    }
+
+    return 0;
+}
+
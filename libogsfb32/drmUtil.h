@@ -56,15 +56,16 @@ using drmModeRes_ptr = std::unique_ptr<drmModeRes, decltype(&drmModeFreeResource
 
 //-------------------------------------------------------------------------
 
-drmModeConnector_ptr drmModeGetConnector(ogsfb32::FileDescriptor& fd, uint32_t connId);
-drmModeCrtc_ptr drmModeGetCrtc(ogsfb32::FileDescriptor& fd, uint32_t crtcId);
-drmModeEncoder_ptr drmModeGetEncoder(ogsfb32::FileDescriptor& fd, uint32_t encoderId);
-drmModeObjectProperties_ptr drmModeObjectGetProperties(ogsfb32::FileDescriptor& fd, uint32_t objectId, uint32_t objectType);
-drmModePlane_ptr drmModeGetPlane(ogsfb32::FileDescriptor& fd, uint32_t planeId);
-drmModePlaneRes_ptr drmModeGetPlaneResources(ogsfb32::FileDescriptor& fd);
-drmModePropertyRes_ptr drmModeGetProperty(ogsfb32::FileDescriptor& fd, uint32_t propertyId);
-drmModeRes_ptr drmModeGetResources(ogsfb32::FileDescriptor& fd);
-uint64_t drmGetPropertyValue(ogsfb32::FileDescriptor& fd, uint32_t objectId, uint32_t objectType, const std::string& name);
+drmModeConnector_ptr drmModeGetConnector(const ogsfb32::FileDescriptor& fd, uint32_t connId);
+drmModeCrtc_ptr drmModeGetCrtc(const ogsfb32::FileDescriptor& fd, uint32_t crtcId);
+drmModeEncoder_ptr drmModeGetEncoder(const ogsfb32::FileDescriptor& fd, uint32_t encoderId);
+drmModeObjectProperties_ptr drmModeObjectGetProperties(const ogsfb32::FileDescriptor& fd, uint32_t objectId, uint32_t objectType);
+drmModePlane_ptr drmModeGetPlane(const ogsfb32::FileDescriptor& fd, uint32_t planeId);
+drmModePlaneRes_ptr drmModeGetPlaneResources(const ogsfb32::FileDescriptor& fd);
+drmModePropertyRes_ptr drmModeGetProperty(const ogsfb32::FileDescriptor& fd, uint32_t propertyId);
+drmModeRes_ptr drmModeGetResources(const ogsfb32::FileDescriptor& fd);
+uint64_t drmGetPropertyValue(const ogsfb32::FileDescriptor& fd, uint32_t objectId, uint32_t objectType, const std::string& name);
+uint32_t drmGetPropertyId(const ogsfb32::FileDescriptor& fd, uint32_t objectId, uint32_t objectType, const std::string& name);
 
 //-------------------------------------------------------------------------
 
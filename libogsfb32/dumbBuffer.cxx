@@ -0,0 +1,137 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <xf86drm.h>
+#include <xf86drmMode.h>
+#include <sys/mman.h>
+
+#include <cerrno>
+#include <system_error>
+
+#include "dumbBuffer.h"
+
+//-------------------------------------------------------------------------
+
+ogsfb32::DumbBuffer:: DumbBuffer(
+    const FileDescriptor& fd,
+    uint32_t width,
+    uint32_t height,
+    uint32_t format)
+:
+    m_fd{fd.fd()},
+    m_width{width},
+    m_height{height},
+    m_handle{0},
+    m_fbId{0},
+    m_buffer{nullptr},
+    m_length{0},
+    m_lineLengthPixels{0}
+{
+    struct drm_mode_create_dumb dmcb =
+    {
+        .height = height,
+        .width = width,
+        .bpp = 32,
+        .flags = 0,
+        .handle = 0,
+        .pitch = 0,
+        .size = 0
+    };
+
+    if (drmIoctl(m_fd, DRM_IOCTL_MODE_CREATE_DUMB, &dmcb) < 0)
+    {
+        throw std::system_error{errno,
+                                std::system_category(),
+                                "Cannot create a DRM dumb buffer"};
+    }
+
+    m_handle = dmcb.handle;
+    m_length = dmcb.size;
+    m_lineLengthPixels = dmcb.pitch / sizeof(uint32_t);
+
+    //---------------------------------------------------------------------
+
+    uint32_t handles[4] = { dmcb.handle };
+    uint32_t strides[4] = { dmcb.pitch };
+    uint32_t offsets[4] = { 0 };
+
+    if (drmModeAddFB2(m_fd,
+                      width,
+                      height,
+                      format,
+                      handles,
+                      strides,
+                      offsets,
+                      &m_fbId,
+                      0) < 0)
+    {
+        const int error = errno;
+        struct drm_mode_destroy_dumb dmdd = { .handle = m_handle };
+        drmIoctl(m_fd, DRM_IOCTL_MODE_DESTROY_DUMB, &dmdd);
+
+        throw std::system_error{error,
+                                std::system_category(),
+                                "Cannot add frame buffer"};
+    }
+
+    //---------------------------------------------------------------------
+
+    struct drm_mode_map_dumb dmmd = { .handle = m_handle };
+    void* buffer = MAP_FAILED;
+
+    if (drmIoctl(m_fd, DRM_IOCTL_MODE_MAP_DUMB, &dmmd) == 0)
+    {
+        buffer = ::mmap(0, m_length, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, dmmd.offset);
+    }
+
+    if (buffer == MAP_FAILED)
+    {
+        const int error = errno;
+        drmModeRmFB(m_fd, m_fbId);
+        struct drm_mode_destroy_dumb dmdd = { .handle = m_handle };
+        drmIoctl(m_fd, DRM_IOCTL_MODE_DESTROY_DUMB, &dmdd);
+
+        throw std::system_error{error,
+                                std::system_category(),
+                                "Cannot map dumb buffer"};
+    }
+
+    m_buffer = static_cast<uint32_t*>(buffer);
+}
+
+//-------------------------------------------------------------------------
+
+ogsfb32::DumbBuffer:: ~DumbBuffer()
+{
+    ::munmap(m_buffer, m_length);
+    drmModeRmFB(m_fd, m_fbId);
+
+    struct drm_mode_destroy_dumb dmdd = { .handle = m_handle };
+    drmIoctl(m_fd, DRM_IOCTL_MODE_DESTROY_DUMB, &dmdd);
+}
+
@@ -0,0 +1,87 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <cstddef>
+#include <cstdint>
+
+#include "fileDescriptor.h"
+
+//-------------------------------------------------------------------------
+
+namespace ogsfb32
+{
+
+//-------------------------------------------------------------------------
+
+// A 32 bit per pixel DRM dumb buffer, added as a frame buffer and mapped
+// into memory. The width and height are those of the display, not of the
+// rotated screen.
+
+class DumbBuffer
+{
+public:
+
+    DumbBuffer(
+        const FileDescriptor& fd,
+        uint32_t width,
+        uint32_t height,
+        uint32_t format);
+
+    ~DumbBuffer();
+
+    DumbBuffer(const DumbBuffer&) = delete;
+    DumbBuffer& operator=(const DumbBuffer&) = delete;
+
+    uint32_t getWidth() const { return m_width; }
+    uint32_t getHeight() const { return m_height; }
+    uint32_t getFbId() const { return m_fbId; }
+
+    uint32_t* getBuffer() const { return m_buffer; }
+    size_t getLength() const { return m_length; }
+    int32_t getLineLengthPixels() const { return m_lineLengthPixels; }
+
+private:
+
+    int m_fd;
+    uint32_t m_width;
+    uint32_t m_height;
+    uint32_t m_handle;
+    uint32_t m_fbId;
+    uint32_t* m_buffer;
+    size_t m_length;
+    int32_t m_lineLengthPixels;
+};
+
+//-------------------------------------------------------------------------
+
+} // namespace ogsfb32
+
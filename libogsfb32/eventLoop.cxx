@@ -0,0 +1,291 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <sys/epoll.h>
+#include <sys/signalfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <system_error>
+
+#include "eventLoop.h"
+
+//-------------------------------------------------------------------------
+
+ogsfb32::EventLoop:: EventLoop()
+:
+    m_epollFd{::epoll_create1(EPOLL_CLOEXEC)},
+    m_callbacks(),
+    m_timers(),
+    m_signalFd{-1},
+    m_signals(),
+    m_signalCallbacks(),
+    m_idle(),
+    m_running{false}
+{
+    if (m_epollFd.fd() == -1)
+    {
+        throw std::system_error{errno,
+                                std::system_category(),
+                                "cannot create epoll instance"};
+    }
+
+    sigemptyset(&m_signals);
+}
+
+//-------------------------------------------------------------------------
+
+ogsfb32::EventLoop:: ~EventLoop()
+{
+    ::sigprocmask(SIG_UNBLOCK, &m_signals, nullptr);
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::EventLoop:: addReader(
+    int fd,
+    Callback callback)
+{
+    add(fd, std::move(callback));
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::EventLoop:: removeReader(
+    int fd)
+{
+    ::epoll_ctl(m_epollFd.fd(), EPOLL_CTL_DEL, fd, nullptr);
+    m_callbacks.erase(fd);
+}
+
+//-------------------------------------------------------------------------
+
+int
+ogsfb32::EventLoop:: addTimer(
+    std::chrono::nanoseconds interval,
+    Callback callback)
+{
+    FileDescriptor timerFd{::timerfd_create(CLOCK_MONOTONIC,
+                                            TFD_NONBLOCK | TFD_CLOEXEC)};
+
+    if (timerFd.fd() == -1)
+    {
+        throw std::system_error{errno,
+                                std::system_category(),
+                                "cannot create timer"};
+    }
+
+    const auto seconds =
+        std::chrono::duration_cast<std::chrono::seconds>(interval);
+
+    struct itimerspec spec{};
+    spec.it_interval.tv_sec = seconds.count();
+    spec.it_interval.tv_nsec = (interval - seconds).count();
+    spec.it_value = spec.it_interval;
+
+    if (::timerfd_settime(timerFd.fd(), 0, &spec, nullptr) == -1)
+    {
+        throw std::system_error{errno,
+                                std::system_category(),
+                                "cannot start timer"};
+    }
+
+    const int fd = timerFd.fd();
+
+    add(fd, [fd, callback = std::move(callback)]
+    {
+        uint64_t expirations = 0;
+
+        if (::read(fd, &expirations, sizeof(expirations)) > 0)
+        {
+            callback();
+        }
+    });
+
+    m_timers.emplace(fd, std::move(timerFd));
+
+    return fd;
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::EventLoop:: removeTimer(
+    int timer)
+{
+    removeReader(timer);
+    m_timers.erase(timer);
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::EventLoop:: addSignal(
+    int signalNumber,
+    Callback callback)
+{
+    sigaddset(&m_signals, signalNumber);
+
+    if (::sigprocmask(SIG_BLOCK, &m_signals, nullptr) == -1)
+    {
+        throw std::system_error{errno,
+                                std::system_category(),
+                                "cannot block signal"};
+    }
+
+    const int fd = ::signalfd(m_signalFd.fd(),
+                              &m_signals,
+                              SFD_NONBLOCK | SFD_CLOEXEC);
+
+    if (fd == -1)
+    {
+        throw std::system_error{errno,
+                                std::system_category(),
+                                "cannot create signalfd"};
+    }
+
+    if (fd != m_signalFd.fd())
+    {
+        m_signalFd = FileDescriptor{fd};
+        add(fd, [this] { readSignals(); });
+    }
+
+    m_signalCallbacks[signalNumber] = callback;
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::EventLoop:: setIdle(
+    IdleCallback idle)
+{
+    m_idle = idle;
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::EventLoop:: run()
+{
+    std::array<struct epoll_event, 16> events;
+    bool busy = static_cast<bool>(m_idle);
+
+    m_running = true;
+
+    while (m_running)
+    {
+        const int count = ::epoll_wait(m_epollFd.fd(),
+                                       events.data(),
+                                       events.size(),
+                                       (busy) ? 0 : -1);
+
+        if (count == -1)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            throw std::system_error{errno,
+                                    std::system_category(),
+                                    "waiting for events"};
+        }
+
+        for (int i = 0 ; (i < count) and m_running ; ++i)
+        {
+            // Look the callback up for each event, as an earlier callback
+            // may have removed it. Copying the pointer, rather than the
+            // function, does not allocate.
+
+            auto callback = m_callbacks.find(events[i].data.fd);
+
+            if (callback != m_callbacks.end())
+            {
+                const auto function = callback->second;
+                (*function)();
+            }
+        }
+
+        if (m_idle and m_running)
+        {
+            busy = m_idle();
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::EventLoop:: stop()
+{
+    m_running = false;
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::EventLoop:: add(
+    int fd,
+    Callback callback)
+{
+    struct epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.fd = fd;
+
+    if (::epoll_ctl(m_epollFd.fd(), EPOLL_CTL_ADD, fd, &event) == -1)
+    {
+        throw std::system_error{errno,
+                                std::system_category(),
+                                "cannot add file descriptor to epoll"};
+    }
+
+    m_callbacks[fd] = std::make_shared<Callback>(std::move(callback));
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::EventLoop:: readSignals()
+{
+    struct signalfd_siginfo info;
+
+    while (::read(m_signalFd.fd(), &info, sizeof(info)) == sizeof(info))
+    {
+        auto callback = m_signalCallbacks.find(info.ssi_signo);
+
+        if (callback != m_signalCallbacks.end())
+        {
+            callback->second();
+        }
+    }
+}
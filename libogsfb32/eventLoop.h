@@ -0,0 +1,108 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <signal.h>
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+
+#include "fileDescriptor.h"
+
+//-------------------------------------------------------------------------
+
+namespace ogsfb32
+{
+
+//-------------------------------------------------------------------------
+
+// Waits on file descriptors, timers and signals through one epoll, calling
+// back when each is ready, so an application sleeps until there is
+// something to do. Timers use timerfd and signals use signalfd; signals
+// added to the loop are blocked so they are only seen by the loop.
+//
+// An idle callback is called after each batch of events. If it returns
+// true it has more work to do and the loop polls without waiting.
+
+class EventLoop
+{
+public:
+
+    using Callback = std::function<void()>;
+    using IdleCallback = std::function<bool()>;
+
+    EventLoop();
+    ~EventLoop();
+
+    EventLoop(const EventLoop&) = delete;
+    EventLoop& operator=(const EventLoop&) = delete;
+
+    void addReader(int fd, Callback callback);
+    void removeReader(int fd);
+
+    // Returns an identifier for removeTimer(). A timer that has expired
+    // more than once by the time the loop sees it calls back once.
+
+    int addTimer(std::chrono::nanoseconds interval, Callback callback);
+    void removeTimer(int timer);
+
+    void addSignal(int signalNumber, Callback callback);
+
+    void setIdle(IdleCallback idle);
+
+    void run();
+    void stop();
+
+private:
+
+    void add(int fd, Callback callback);
+    void readSignals();
+
+    // Callbacks are shared so that run() can keep one alive while it is
+    // called, even if it removes itself, without copying the function.
+
+    FileDescriptor m_epollFd;
+    std::map<int, std::shared_ptr<Callback>> m_callbacks;
+    std::map<int, FileDescriptor> m_timers;
+
+    FileDescriptor m_signalFd;
+    sigset_t m_signals;
+    std::map<int, Callback> m_signalCallbacks;
+
+    IdleCallback m_idle;
+    bool m_running;
+};
+
+//-------------------------------------------------------------------------
+
+} // namespace ogsfb32
@@ -0,0 +1,150 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+#include <stdexcept>
+
+#include "frameArena.h"
+
+//-------------------------------------------------------------------------
+
+ogsfb32::FrameArena:: FrameArena(
+    size_t capacity)
+:
+    m_blocks(),
+    m_block{nullptr},
+    m_blockSize{0},
+    m_offset{0},
+    m_used{0},
+    m_capacity{0}
+{
+    addBlock(std::max<size_t>(capacity, 1));
+}
+
+//-------------------------------------------------------------------------
+
+void*
+ogsfb32::FrameArena:: allocate(
+    size_t size,
+    size_t alignment)
+{
+    auto aligned = [this, alignment]
+    {
+        const auto address = reinterpret_cast<uintptr_t>(m_block) + m_offset;
+        const auto padding = (alignment - (address % alignment)) % alignment;
+
+        return m_offset + padding;
+    };
+
+    size_t offset = aligned();
+
+    if ((offset + size) > m_blockSize)
+    {
+        m_used += m_offset;
+        addBlock(std::max(m_blockSize, size + alignment));
+        offset = aligned();
+    }
+
+    m_offset = offset + size;
+
+    return m_block + offset;
+}
+
+//-------------------------------------------------------------------------
+
+std::string_view
+ogsfb32::FrameArena:: format(
+    const char* format,
+    ...)
+{
+    va_list args;
+    va_list retry;
+
+    va_start(args, format);
+    va_copy(retry, args);
+
+    // Try the rest of the block first, as the text usually fits.
+
+    char* text = reinterpret_cast<char*>(m_block + m_offset);
+    const int length = std::vsnprintf(text, m_blockSize - m_offset, format, args);
+
+    va_end(args);
+
+    if (length < 0)
+    {
+        va_end(retry);
+        throw std::runtime_error{"cannot format text"};
+    }
+
+    if (static_cast<size_t>(length) < (m_blockSize - m_offset))
+    {
+        m_offset += length + 1;
+    }
+    else
+    {
+        text = allocate<char>(length + 1);
+        std::vsnprintf(text, length + 1, format, retry);
+    }
+
+    va_end(retry);
+
+    return std::string_view(text, length);
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::FrameArena:: reset()
+{
+    if (m_blocks.size() > 1)
+    {
+        const size_t capacity = m_capacity;
+
+        m_blocks.clear();
+        m_capacity = 0;
+        addBlock(capacity);
+    }
+
+    m_offset = 0;
+    m_used = 0;
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::FrameArena:: addBlock(
+    size_t size)
+{
+    m_blocks.push_back(std::make_unique<uint8_t[]>(size));
+    m_block = m_blocks.back().get();
+    m_blockSize = size;
+    m_offset = 0;
+    m_capacity += size;
+}
@@ -0,0 +1,164 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+//-------------------------------------------------------------------------
+
+namespace ogsfb32
+{
+
+//-------------------------------------------------------------------------
+
+// Memory for things that only last for a frame, such as the text drawn in
+// it. Allocating moves a pointer along a block and nothing is freed until
+// reset(). A frame that needs more than the block holds gets overflow
+// blocks, which are merged into one larger block at the next reset, so a
+// steady frame stops allocating after the first few.
+
+class FrameArena
+{
+public:
+
+    static constexpr size_t defaultCapacity{4096};
+
+    explicit FrameArena(size_t capacity = defaultCapacity);
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    template<typename T>
+    T*
+    allocate(
+        size_t n)
+    {
+        return static_cast<T*>(allocate(n * sizeof(T), alignof(T)));
+    }
+
+    // printf into the arena. The view is null terminated.
+
+    std::string_view
+    format(
+        const char* format,
+        ...) __attribute__((format(printf, 2, 3)));
+
+    void reset();
+
+    size_t getCapacity() const { return m_capacity; }
+    size_t getUsed() const { return m_used + m_offset; }
+
+private:
+
+    void addBlock(size_t size);
+
+    std::vector<std::unique_ptr<uint8_t[]>> m_blocks;
+    uint8_t* m_block;
+    size_t m_blockSize;
+    size_t m_offset;
+    size_t m_used;
+    size_t m_capacity;
+};
+
+//-------------------------------------------------------------------------
+
+// A standard allocator that takes its memory from a FrameArena. The
+// containers using it must not outlive the arena's next reset().
+
+template<typename T>
+class ArenaAllocator
+{
+public:
+
+    using value_type = T;
+
+    explicit ArenaAllocator(FrameArena& arena) noexcept
+    :
+        m_arena{&arena}
+    {
+    }
+
+    template<typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept
+    :
+        m_arena{other.getArena()}
+    {
+    }
+
+    T* allocate(size_t n) { return m_arena->allocate<T>(n); }
+    void deallocate(T*, size_t) noexcept { }
+
+    FrameArena* getArena() const noexcept { return m_arena; }
+
+private:
+
+    FrameArena* m_arena;
+};
+
+//-------------------------------------------------------------------------
+
+template<typename T, typename U>
+bool
+operator==(
+    const ArenaAllocator<T>& lhs,
+    const ArenaAllocator<U>& rhs)
+{
+    return lhs.getArena() == rhs.getArena();
+}
+
+template<typename T, typename U>
+bool
+operator!=(
+    const ArenaAllocator<T>& lhs,
+    const ArenaAllocator<U>& rhs)
+{
+    return not (lhs == rhs);
+}
+
+//-------------------------------------------------------------------------
+
+template<typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+using ArenaString = std::basic_string<char,
+                                      std::char_traits<char>,
+                                      ArenaAllocator<char>>;
+
+//-------------------------------------------------------------------------
+
+} // namespace ogsfb32
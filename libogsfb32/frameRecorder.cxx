@@ -0,0 +1,265 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <system_error>
+#include <utility>
+
+#include "frameRecorder.h"
+#include "profiler.h"
+
+//-------------------------------------------------------------------------
+
+ogsfb32::FrameRecorder:: FrameRecorder(
+    const std::string& filename,
+    int32_t width,
+    int32_t height,
+    uint32_t frameRate)
+:
+    m_width{width},
+    m_height{height},
+    m_frameRate{std::max(frameRate, 1U)},
+    m_file{filename, std::ios::binary | std::ios::trunc},
+    m_planes(width * height * 3),
+    m_resync{true},
+    m_dropped{0},
+    m_mutex(),
+    m_ready(),
+    m_queue(),
+    m_spare(),
+    m_stop{false},
+    m_thread()
+{
+    if (not m_file)
+    {
+        throw std::system_error{errno,
+                                std::system_category(),
+                                "cannot open " + filename};
+    }
+
+    // Full resolution chroma, so there is no colour bleeding around the
+    // single pixel lines of the panels.
+
+    m_file << "YUV4MPEG2"
+           << " W" << m_width
+           << " H" << m_height
+           << " F" << m_frameRate << ":1"
+           << " Ip A1:1 C444\n";
+
+    m_thread = std::thread(&FrameRecorder::write, this);
+}
+
+//-------------------------------------------------------------------------
+
+ogsfb32::FrameRecorder:: ~FrameRecorder()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+
+    m_ready.notify_one();
+    m_thread.join();
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::FrameRecorder:: addFrame(
+    const uint32_t* buffer,
+    int32_t lineLengthPixels,
+    const std::vector<Area>& changed,
+    std::chrono::steady_clock::time_point time)
+{
+    ProfileScope profileScope{"record"};
+
+    Update update;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_queue.size() >= maxQueued)
+        {
+            ++m_dropped;
+            m_resync = true;
+            return;
+        }
+
+        if (not m_spare.empty())
+        {
+            update = std::move(m_spare.back());
+            m_spare.pop_back();
+        }
+    }
+
+    update.time = time;
+
+    if (m_resync)
+    {
+        update.areas.assign(1, Area{ 0, 0, m_height, m_width });
+        m_resync = false;
+    }
+    else
+    {
+        update.areas = changed;
+    }
+
+    size_t size = 0;
+
+    for (const auto& area : update.areas)
+    {
+        size += (area.x2 - area.x1) * (area.y2 - area.y1);
+    }
+
+    update.pixels.resize(size);
+    uint32_t* pixels = update.pixels.data();
+
+    for (const auto& area : update.areas)
+    {
+        for (int32_t line = area.y1 ; line < area.y2 ; ++line)
+        {
+            const uint32_t* start = buffer + (line * lineLengthPixels);
+            pixels = std::copy(start + area.x1, start + area.x2, pixels);
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queue.push_back(std::move(update));
+    }
+
+    m_ready.notify_one();
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::FrameRecorder:: write()
+{
+    bool first = true;
+    std::chrono::steady_clock::time_point previous;
+
+    while (true)
+    {
+        Update update;
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_ready.wait(lock, [this] { return m_stop or not m_queue.empty(); });
+
+            if (m_queue.empty())
+            {
+                break;
+            }
+
+            update = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+
+        // The previous frame was shown until this one.
+
+        if (not first)
+        {
+            const std::chrono::duration<double> shown = update.time - previous;
+            const double periods = std::round(shown.count() * m_frameRate);
+
+            writeFrames(std::clamp(periods, 1.0, double(m_frameRate)));
+        }
+
+        first = false;
+        previous = update.time;
+
+        convert(update);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_spare.push_back(std::move(update));
+    }
+
+    if (not first)
+    {
+        writeFrames(1);
+    }
+
+    m_file.flush();
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::FrameRecorder:: convert(
+    const Update& update)
+{
+    const size_t planeSize = m_width * m_height;
+    uint8_t* yPlane = m_planes.data();
+    uint8_t* uPlane = yPlane + planeSize;
+    uint8_t* vPlane = uPlane + planeSize;
+
+    const uint32_t* pixel = update.pixels.data();
+
+    for (const auto& area : update.areas)
+    {
+        for (int32_t line = area.y1 ; line < area.y2 ; ++line)
+        {
+            const int32_t x = m_width - 1 - line;
+
+            for (int32_t y = area.x1 ; y < area.x2 ; ++y)
+            {
+                const int32_t rgb = *pixel++;
+                const int32_t r = (rgb >> 16) & 0xFF;
+                const int32_t g = (rgb >> 8) & 0xFF;
+                const int32_t b = rgb & 0xFF;
+
+                // ITU-R BT.601 with video range, which is what players
+                // assume for Y4M.
+
+                const size_t i = (y * m_width) + x;
+
+                yPlane[i] = ((66 * r + 129 * g + 25 * b + 128) >> 8) + 16;
+                uPlane[i] = ((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128;
+                vPlane[i] = ((112 * r - 94 * g - 18 * b + 128) >> 8) + 128;
+            }
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::FrameRecorder:: writeFrames(
+    uint32_t count)
+{
+    for (uint32_t i = 0 ; i < count ; ++i)
+    {
+        m_file << "FRAME\n";
+        m_file.write(reinterpret_cast<const char*>(m_planes.data()),
+                     m_planes.size());
+    }
+}
+
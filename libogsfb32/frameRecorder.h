@@ -0,0 +1,129 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "scaler.h"
+
+//-------------------------------------------------------------------------
+
+namespace ogsfb32
+{
+
+//-------------------------------------------------------------------------
+
+// Records frames to a YUV4MPEG2 (Y4M) file, which ffmpeg and most video
+// players read. Frames are laid out as the frame buffer's, each line a
+// column of the screen, and addFrame() is given the areas of the frame
+// that changed in those coordinates.
+//
+// Only the changed areas are copied on the calling thread. A thread of
+// its own converts them to YUV and writes the file. Each frame is
+// repeated for the number of frame periods until the next one, so the
+// video plays back with the timing it was presented with. Gaps of more
+// than a second are cut to a second.
+//
+// If the writer falls behind, frames are dropped and the next one is
+// copied whole.
+
+class FrameRecorder
+{
+public:
+
+    using Area = Scaler::Area;
+
+    FrameRecorder(
+        const std::string& filename,
+        int32_t width,
+        int32_t height,
+        uint32_t frameRate);
+
+    ~FrameRecorder();
+
+    FrameRecorder(const FrameRecorder&) = delete;
+    FrameRecorder& operator=(const FrameRecorder&) = delete;
+
+    void
+    addFrame(
+        const uint32_t* buffer,
+        int32_t lineLengthPixels,
+        const std::vector<Area>& changed,
+        std::chrono::steady_clock::time_point time);
+
+    uint32_t getDroppedFrames() const { return m_dropped; }
+
+private:
+
+    static constexpr size_t maxQueued{8};
+
+    struct Update
+    {
+        std::chrono::steady_clock::time_point time;
+        std::vector<Area> areas;
+        std::vector<uint32_t> pixels;
+    };
+
+    void write();
+    void convert(const Update& update);
+    void writeFrames(uint32_t count);
+
+    int32_t m_width;
+    int32_t m_height;
+    uint32_t m_frameRate;
+    std::ofstream m_file;
+    std::vector<uint8_t> m_planes;
+
+    bool m_resync;
+    std::atomic<uint32_t> m_dropped;
+
+    std::mutex m_mutex;
+    std::condition_variable m_ready;
+    std::deque<Update> m_queue;
+    std::vector<Update> m_spare;
+    bool m_stop;
+
+    std::thread m_thread;
+};
+
+//-------------------------------------------------------------------------
+
+} // namespace ogsfb32
+
@@ -26,6 +26,7 @@
 //-------------------------------------------------------------------------
 
 #include <fcntl.h>
+#include <poll.h>
 #include <stdlib.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -38,16 +39,25 @@
 #include <sys/mman.h>
 
 #include <algorithm>
+#include <array>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <memory>
+#include <stdexcept>
 #include <string>
 #include <system_error>
+#include <utility>
+#include <vector>
 
+#include "atomicModeset.h"
 #include "drmUtil.h"
 #include "framebuffer8880.h"
+#include "frameRecorder.h"
 #include "image8880.h"
+#include "image8880Transform.h"
 #include "point.h"
+#include "profiler.h"
 
 //=========================================================================
 
@@ -56,46 +66,231 @@ namespace
 
 //-------------------------------------------------------------------------
 
+int
+openDevice(
+    const std::string& device)
+{
+    const int fd = ::open(device.c_str(), O_RDWR);
+
+    if (fd == -1)
+    {
+        throw std::system_error{errno,
+                                std::system_category(),
+                                "cannot open dri device " + device};
+    }
+
+    return fd;
+}
+
+//-------------------------------------------------------------------------
+
+int
+duplicateDevice(
+    const ogsfb32::FileDescriptor& device)
+{
+    const int fd = ::fcntl(device.fd(), F_DUPFD_CLOEXEC, 0);
+
+    if (fd == -1)
+    {
+        throw std::system_error{errno,
+                                std::system_category(),
+                                "cannot duplicate dri device"};
+    }
+
+    return fd;
+}
+
+//-------------------------------------------------------------------------
+
+// Connector names as the kernel gives them, indexed by connector type.
+
+std::string
+connectorName(
+    const drmModeConnector& connector)
+{
+    static constexpr std::array<const char*, 21> names
+    {
+        "Unknown",
+        "VGA",
+        "DVI-I",
+        "DVI-D",
+        "DVI-A",
+        "Composite",
+        "SVIDEO",
+        "LVDS",
+        "Component",
+        "DIN",
+        "DP",
+        "HDMI-A",
+        "HDMI-B",
+        "TV",
+        "eDP",
+        "Virtual",
+        "DSI",
+        "DPI",
+        "Writeback",
+        "SPI",
+        "USB"
+    };
+
+    const char* name = (connector.connector_type < names.size())
+                     ? names[connector.connector_type]
+                     : names[0];
+
+    return std::string(name) + "-" + std::to_string(connector.connector_type_id);
+}
+
+//-------------------------------------------------------------------------
+
 bool
-findDrmResources(
-    ogsfb32::FileDescriptor& fd,
-    uint32_t& crtcId,
-    uint32_t& connectorId,
-    drmModeModeInfo& mode)
+isBuiltIn(
+    uint32_t connectorType)
 {
-    auto resources = drm::drmModeGetResources(fd);
-    bool resourcesFound = false;
+    switch (connectorType)
+    {
+    case DRM_MODE_CONNECTOR_LVDS:
+    case DRM_MODE_CONNECTOR_eDP:
+    case DRM_MODE_CONNECTOR_DSI:
+    case DRM_MODE_CONNECTOR_DPI:
 
-    for (int i = 0 ; (i < resources->count_connectors) and not resourcesFound ; ++i)
+        return true;
+
+    default:
+
+        return false;
+    }
+}
+
+//-------------------------------------------------------------------------
+
+ogsfb32::FrameBuffer8880::Display
+findDisplay(
+    const ogsfb32::FileDescriptor& fd,
+    const std::string& connector)
+{
+    for (const auto& display : ogsfb32::FrameBuffer8880::getDisplays(fd))
     {
-        connectorId = resources->connectors[i];
-        auto connector = drm::drmModeGetConnector(fd, connectorId);
-        const bool connected = (connector->connection == DRM_MODE_CONNECTED);
+        if (connector.empty() or (display.name == connector))
+        {
+            return display;
+        }
+    }
 
-        if (connected and (connector->count_modes > 0))
+    if (connector.empty())
+    {
+        throw std::logic_error("no connected CRTC found");
+    }
+
+    throw std::runtime_error("display " + connector + " not found");
+}
+
+//-------------------------------------------------------------------------
+
+ogsfb32::FrameBuffer8880::Mode
+toMode(
+    const drmModeModeInfo& mode)
+{
+    return ogsfb32::FrameBuffer8880::Mode{
+        mode.hdisplay,
+        mode.vdisplay,
+        mode.vrefresh,
+        (mode.type & DRM_MODE_TYPE_PREFERRED) != 0 };
+}
+
+//-------------------------------------------------------------------------
+
+drmModeModeInfo
+chooseMode(
+    const ogsfb32::FileDescriptor& fd,
+    uint32_t connectorId,
+    uint32_t crtcId,
+    const ogsfb32::FrameBuffer8880::Options& options)
+{
+    if ((options.width == 0) and
+        (options.height == 0) and
+        (options.refresh == 0))
+    {
+        auto crtc = drm::drmModeGetCrtc(fd, crtcId);
+
+        if (crtc->mode_valid)
         {
-            for (int j = 0 ; (j < resources->count_encoders) and not resourcesFound ; ++j)
-            {
-                uint32_t encoderId = resources->encoders[j];
-                auto encoder = drm::drmModeGetEncoder(fd, encoderId);
+            return crtc->mode;
+        }
+    }
 
-                for (int k = 0 ; (k < resources->count_crtcs) and not resourcesFound ; ++k)
-                {
-                    uint32_t currentCrtc = 1 << k;
-
-                    if (encoder->possible_crtcs & currentCrtc)
-                    {
-                        crtcId = resources->crtcs[k];
-                        auto crtc = drm::drmModeGetCrtc(fd, crtcId);
-                        mode = crtc->mode;
-                        resourcesFound = true;
-                    }
-                }
-            }
+    // Rank matching modes by how far their refresh is from the one asked
+    // for, then by whether they are preferred.
+
+    auto rank = [&options](const drmModeModeInfo& mode)
+    {
+        const uint32_t distance = (options.refresh == 0)
+                                ? 0
+                                : std::max(mode.vrefresh, options.refresh) -
+                                  std::min(mode.vrefresh, options.refresh);
+
+        return std::make_pair(distance, (mode.type & DRM_MODE_TYPE_PREFERRED) == 0);
+    };
+
+    auto connector = drm::drmModeGetConnector(fd, connectorId);
+    const drmModeModeInfo* chosen = nullptr;
+
+    for (int i = 0 ; i < connector->count_modes ; ++i)
+    {
+        const drmModeModeInfo& mode = connector->modes[i];
+
+        if (((options.width != 0) and (mode.hdisplay != options.width)) or
+            ((options.height != 0) and (mode.vdisplay != options.height)))
+        {
+            continue;
+        }
+
+        if ((chosen == nullptr) or (rank(mode) < rank(*chosen)))
+        {
+            chosen = &mode;
         }
     }
 
-    return resourcesFound;
+    if (chosen == nullptr)
+    {
+        throw std::runtime_error("no matching display mode found");
+    }
+
+    return *chosen;
+}
+
+//-------------------------------------------------------------------------
+
+uint32_t
+findPrimaryPlane(
+    ogsfb32::FileDescriptor& fd,
+    uint32_t crtcIndex)
+{
+    drmSetClientCap(fd.fd(), DRM_CLIENT_CAP_UNIVERSAL_PLANES, 1);
+
+    auto planeResources = drm::drmModeGetPlaneResources(fd);
+
+    if (not planeResources)
+    {
+        return 0;
+    }
+
+    for (uint32_t i = 0 ; i < planeResources->count_planes ; ++i)
+    {
+        const uint32_t planeId = planeResources->planes[i];
+        auto plane = drm::drmModeGetPlane(fd, planeId);
+
+        if (plane and
+            (plane->possible_crtcs & (1 << crtcIndex)) and
+            (drm::drmGetPropertyValue(fd,
+                                      planeId,
+                                      DRM_MODE_OBJECT_PLANE,
+                                      "type") == DRM_PLANE_TYPE_PRIMARY))
+        {
+            return planeId;
+        }
+    }
+
+    return 0;
 }
 
 //-------------------------------------------------------------------------
@@ -106,25 +301,62 @@ findDrmResources(
 
 ogsfb32::FrameBuffer8880:: FrameBuffer8880(
     const std::string& device)
+:
+    FrameBuffer8880(device, Options{})
+{
+}
+
+//-------------------------------------------------------------------------
+
+ogsfb32::FrameBuffer8880:: FrameBuffer8880(
+    const std::string& device,
+    const Options& options)
+:
+    FrameBuffer8880(openDevice(device), options)
+{
+}
+
+//-------------------------------------------------------------------------
+
+ogsfb32::FrameBuffer8880:: FrameBuffer8880(
+    const FileDescriptor& device,
+    const Options& options)
+:
+    FrameBuffer8880(duplicateDevice(device), options)
+{
+}
+
+//-------------------------------------------------------------------------
+
+ogsfb32::FrameBuffer8880:: FrameBuffer8880(
+    int ownedDevice,
+    const Options& options)
 :
     m_width{0},
     m_height{0},
     m_length{0},
     m_lineLengthPixels{0},
-    m_fd{::open(device.c_str(), O_RDWR)},
+    m_fd{ownedDevice},
+    m_name(),
+    m_mode{},
+    m_rotated{true},
+    m_crtcId{0},
+    m_crtcIndex{0},
+    m_vblank{ false, 0, {} },
+    m_atomic{},
+    m_damage(),
+    m_clips(),
     m_fbp{nullptr},
     m_fbId{0},
-    m_fbHandle{0}
+    m_fbHandle{0},
+    m_dumbBuffer{nullptr},
+    m_dumbLength{0},
+    m_dumbLineLengthPixels{0},
+    m_renderBuffer(),
+    m_scaledBuffer(),
+    m_scaler{},
+    m_recorder{}
 {
-    if (m_fd.fd() == -1)
-    {
-        throw std::system_error{errno,
-                                std::system_category(),
-                                "cannot open dri device " + device};
-    }
-
-    //---------------------------------------------------------------------
-
     uint64_t hasDumb;
     if ((drmGetCap(m_fd.fd(), DRM_CAP_DUMB_BUFFER, &hasDumb) < 0) or not hasDumb)
     {
@@ -135,19 +367,18 @@ ogsfb32::FrameBuffer8880:: FrameBuffer8880(
 
     //---------------------------------------------------------------------
 
-    uint32_t crtcId = 0;
-    uint32_t connectorId = 0;
-    drmModeModeInfo mode;
+    const Display display = findDisplay(m_fd, options.connector);
+    uint32_t connectorId = display.connectorId;
 
-    if (not findDrmResources(m_fd, crtcId, connectorId, mode))
-    {
-        throw std::logic_error("no connected CRTC found");
-    }
+    m_name = display.name;
+    m_crtcId = display.crtcId;
+    m_crtcIndex = display.crtcIndex;
 
-    //---------------------------------------------------------------------
+    drmModeModeInfo mode = chooseMode(m_fd, connectorId, m_crtcId, options);
+    m_mode = toMode(mode);
+    m_rotated = (mode.vdisplay > mode.hdisplay);
 
-    m_width = mode.vdisplay;
-    m_height = mode.hdisplay;
+    //---------------------------------------------------------------------
 
     struct drm_mode_create_dumb dmcb =
     {
@@ -169,8 +400,8 @@ ogsfb32::FrameBuffer8880:: FrameBuffer8880(
 
     //---------------------------------------------------------------------
 
-    m_length = dmcb.size;
-    m_lineLengthPixels = dmcb.pitch / bytesPerPixel;
+    m_dumbLength = dmcb.size;
+    m_dumbLineLengthPixels = dmcb.pitch / bytesPerPixel;
     m_fbHandle = dmcb.handle;
 
     uint32_t handles[4] = { dmcb.handle };
@@ -207,7 +438,7 @@ ogsfb32::FrameBuffer8880:: FrameBuffer8880(
                                 "Cannot map dumb buffer"};
     }
 
-    void* fbp = mmap(0, m_length, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd.fd(), dmmd.offset);
+    void* fbp = mmap(0, m_dumbLength, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd.fd(), dmmd.offset);
 
     if (fbp == MAP_FAILED)
     {
@@ -216,11 +447,81 @@ ogsfb32::FrameBuffer8880:: FrameBuffer8880(
                                 "mapping framebuffer device to memory");
     }
 
-    m_fbp = static_cast<uint32_t*>(fbp);
+    m_dumbBuffer = static_cast<uint32_t*>(fbp);
+
+    //---------------------------------------------------------------------
+
+    // Drawing is on the screen, which is the display rotated, unless it is
+    // at a different resolution or the display isn't rotated. Then it is
+    // in memory laid out the same way, with each line a column of the
+    // screen.
+
+    const int32_t screenWidth = (m_rotated) ? mode.vdisplay : mode.hdisplay;
+    const int32_t screenHeight = (m_rotated) ? mode.hdisplay : mode.vdisplay;
+
+    m_width = (options.renderWidth > 0) ? options.renderWidth : screenWidth;
+    m_height = (options.renderHeight > 0) ? options.renderHeight : screenHeight;
+
+    const bool scaled = (static_cast<int32_t>(m_width) != screenWidth) or
+                        (static_cast<int32_t>(m_height) != screenHeight);
+
+    if (scaled or options.shadow or not m_rotated)
+    {
+        m_renderBuffer.resize(m_width * m_height);
+        m_fbp = m_renderBuffer.data();
+        m_length = m_renderBuffer.size() * bytesPerPixel;
+        m_lineLengthPixels = m_height;
+    }
+    else
+    {
+        m_fbp = m_dumbBuffer;
+        m_length = m_dumbLength;
+        m_lineLengthPixels = m_dumbLineLengthPixels;
+    }
+
+    if (scaled)
+    {
+        m_scaler = std::make_unique<Scaler>(m_height,
+                                            m_width,
+                                            screenHeight,
+                                            screenWidth,
+                                            options.filter);
+
+        if (not m_rotated)
+        {
+            m_scaledBuffer.resize(screenWidth * screenHeight);
+        }
+    }
 
     //---------------------------------------------------------------------
 
-    if (drmModeSetCrtc(m_fd.fd(), crtcId, m_fbId, 0, 0, &connectorId, 1, &mode) < 0)
+    // Use atomic modesetting where the driver has it, otherwise fall back
+    // to the legacy interface.
+
+    const uint32_t primaryPlaneId = findPrimaryPlane(m_fd, m_crtcIndex);
+
+    if (primaryPlaneId != 0)
+    {
+        try
+        {
+            m_atomic = std::make_unique<AtomicModeset>(m_fd,
+                                                       connectorId,
+                                                       m_crtcId,
+                                                       primaryPlaneId);
+
+            if (not m_atomic->modeset(mode, m_fbId, mode.hdisplay, mode.vdisplay))
+            {
+                m_atomic.reset();
+            }
+        }
+        catch (const std::exception&)
+        {
+            m_atomic.reset();
+        }
+    }
+
+    if (not m_atomic and
+        (drmModeSetCrtc(m_fd.fd(), m_crtcId, m_fbId, 0, 0, &connectorId, 1, &mode) < 0))
     {
         throw std::system_error(errno,
                                 std::system_category(),
@@ -232,7 +533,30 @@ ogsfb32::FrameBuffer8880:: FrameBuffer8880(
 
 ogsfb32::FrameBuffer8880:: ~FrameBuffer8880()
 {
-    ::munmap(m_fbp, m_length);
+    // The event for a commit still in flight could be read by another
+    // frame buffer on the device after this one has gone, so wait for it.
+    // Damage left over, such as from a clear() on the way out, is then
+    // sent, as a commit in flight would have held it back.
+
+    struct pollfd events{ m_fd.fd(), POLLIN, 0 };
+
+    auto wait = [&]
+    {
+        while (m_atomic and m_atomic->isPending() and (::poll(&events, 1, 100) > 0))
+        {
+            handleEvents();
+        }
+    };
+
+    m_recorder.reset();
+
+    wait();
+    present();
+    wait();
+
+    m_atomic.reset();
+
+    ::munmap(m_dumbBuffer, m_dumbLength);
     drmModeRmFB(m_fd.fd(), m_fbId);
 
     struct drm_mode_destroy_dumb dmdd =
@@ -245,11 +569,148 @@ ogsfb32::FrameBuffer8880:: ~FrameBuffer8880()
 
 //-------------------------------------------------------------------------
 
+std::vector<ogsfb32::FrameBuffer8880::Display>
+ogsfb32::FrameBuffer8880:: getDisplays(
+    const FileDescriptor& device)
+{
+    auto resources = drm::drmModeGetResources(device);
+
+    auto crtcIndex = [&resources](uint32_t crtcId)
+    {
+        for (int k = 0 ; k < resources->count_crtcs ; ++k)
+        {
+            if (resources->crtcs[k] == crtcId)
+            {
+                return k;
+            }
+        }
+
+        return -1;
+    };
+
+    uint32_t usedCrtcs = 0;
+
+    auto useCrtc = [&](Display& display, int k)
+    {
+        if ((k >= 0) and not (usedCrtcs & (1 << k)))
+        {
+            display.crtcId = resources->crtcs[k];
+            display.crtcIndex = k;
+            usedCrtcs |= (1 << k);
+        }
+    };
+
+    // Connectors keep the CRTC that is already driving them, so displays
+    // don't move as others come and go.
+
+    std::vector<std::pair<Display, drm::drmModeConnector_ptr>> connected;
+
+    for (int i = 0 ; i < resources->count_connectors ; ++i)
+    {
+        auto connector = drm::drmModeGetConnector(device, resources->connectors[i]);
+
+        if (not connector or
+            (connector->connection != DRM_MODE_CONNECTED) or
+            (connector->count_modes == 0))
+        {
+            continue;
+        }
+
+        Display display{ connectorName(*connector),
+                         connector->connector_id,
+                         0,
+                         0,
+                         isBuiltIn(connector->connector_type) };
+
+        if (connector->encoder_id != 0)
+        {
+            auto encoder = drm::drmModeGetEncoder(device, connector->encoder_id);
+
+            if (encoder and (encoder->crtc_id != 0))
+            {
+                useCrtc(display, crtcIndex(encoder->crtc_id));
+            }
+        }
+
+        connected.emplace_back(display, std::move(connector));
+    }
+
+    // The rest get the first free CRTC one of their encoders can use.
+
+    std::vector<Display> displays;
+
+    for (auto& [display, connector] : connected)
+    {
+        for (int j = 0 ; (j < connector->count_encoders) and (display.crtcId == 0) ; ++j)
+        {
+            auto encoder = drm::drmModeGetEncoder(device, connector->encoders[j]);
+
+            for (int k = 0 ; encoder and (k < resources->count_crtcs) and (display.crtcId == 0) ; ++k)
+            {
+                if (encoder->possible_crtcs & (1 << k))
+                {
+                    useCrtc(display, k);
+                }
+            }
+        }
+
+        if (display.crtcId != 0)
+        {
+            displays.push_back(display);
+        }
+    }
+
+    std::stable_partition(displays.begin(),
+                          displays.end(),
+                          [](const Display& display) { return display.builtIn; });
+
+    return displays;
+}
+
+//-------------------------------------------------------------------------
+
+std::vector<ogsfb32::FrameBuffer8880::Display>
+ogsfb32::FrameBuffer8880:: getDisplays(
+    const std::string& device)
+{
+    return getDisplays(FileDescriptor{openDevice(device)});
+}
+
+//-------------------------------------------------------------------------
+
+std::vector<ogsfb32::FrameBuffer8880::Mode>
+ogsfb32::FrameBuffer8880:: getModes(
+    const std::string& device,
+    const std::string& connector)
+{
+    FileDescriptor fd{openDevice(device)};
+
+    const auto display = findDisplay(fd, connector);
+    auto connectorModes = drm::drmModeGetConnector(fd, display.connectorId);
+    std::vector<Mode> modes;
+
+    for (int i = 0 ; i < connectorModes->count_modes ; ++i)
+    {
+        modes.push_back(toMode(connectorModes->modes[i]));
+    }
+
+    return modes;
+}
+
+//-------------------------------------------------------------------------
+
 void
 ogsfb32::FrameBuffer8880:: clear(
     uint32_t rgb) const
 {
     std::fill(m_fbp, m_fbp + (m_length / bytesPerPixel), rgb);
+
+    if (isInMemory())
+    {
+        std::fill(m_dumbBuffer, m_dumbBuffer + (m_dumbLength / bytesPerPixel), rgb);
+    }
+
+    addDamage();
 }
 
 //-------------------------------------------------------------------------
@@ -305,93 +766,299 @@ ogsfb32::FrameBuffer8880:: getPixel(
 
 //-------------------------------------------------------------------------
 
-bool
-ogsfb32::FrameBuffer8880:: putImage(
-    const FB8880Point& p_left,
-    const Image8880& image) const
+ogsfb32::ImageView8880
+ogsfb32::FrameBuffer8880:: getView() const
 {
-    FB8880Point p{ getWidth() - image.getWidth() - p_left.x(), p_left.y() };
+    return ImageView8880(m_fbp,
+                         m_width,
+                         m_height,
+                         m_lineLengthPixels);
+}
+
+//-------------------------------------------------------------------------
 
-    if ((p.x() < 0) ||
-        ((p.x() + image.getWidth()) > static_cast<int32_t>(m_width)))
+uint32_t*
+ogsfb32::FrameBuffer8880:: getColumn(
+    int32_t x) const
+{
+    if ((x < 0) || (x >= static_cast<int32_t>(m_width)))
     {
-        return putImagePartial(p, image);
+        return nullptr;
     }
 
-    if ((p.y() < 0) ||
-        ((p.y() + image.getHeight()) > static_cast<int32_t>(m_height)))
+    return m_fbp + ((m_width - 1 - x) * m_lineLengthPixels);
+}
+
+//-------------------------------------------------------------------------
+
+bool
+ogsfb32::FrameBuffer8880:: requestVblankEvent() const
+{
+    drmVBlank vblank{};
+
+    // The first two CRTCs have their own flags, the rest are encoded in
+    // the high CRTC bits.
+
+    uint32_t crtc = 0;
+
+    if (m_crtcIndex == 1)
+    {
+        crtc = DRM_VBLANK_SECONDARY;
+    }
+    else if (m_crtcIndex > 1)
     {
-        return putImagePartial(p, image);
+        crtc = (m_crtcIndex << DRM_VBLANK_HIGH_CRTC_SHIFT) &
+               DRM_VBLANK_HIGH_CRTC_MASK;
     }
 
-    for (int32_t i = 0 ; i < image.getWidth() ; ++i)
+    vblank.request.type = static_cast<drmVBlankSeqType>(
+        DRM_VBLANK_RELATIVE | DRM_VBLANK_EVENT | crtc);
+    vblank.request.sequence = 1;
+
+    // The event hands this back as its user data.
+
+    vblank.request.signal = reinterpret_cast<unsigned long>(&m_vblank);
+
+    return drmWaitVBlank(m_fd.fd(), &vblank) == 0;
+}
+
+//-------------------------------------------------------------------------
+
+bool
+ogsfb32::FrameBuffer8880:: handleEvents() const
+{
+    m_vblank.received = false;
+
+    drmEventContext context{};
+    context.version = 2;
+    context.vblank_handler = [](int,
+                                unsigned int sequence,
+                                unsigned int seconds,
+                                unsigned int microseconds,
+                                void* data)
     {
-        auto start = image.getColumn(i);
+        auto vblank = static_cast<Vblank*>(data);
 
-        std::copy(start,
-                  start + image.getHeight(),
-                  m_fbp + ((i + p.x()) * m_lineLengthPixels) + p.y());
+        vblank->received = true;
+        vblank->sequence = sequence;
+        vblank->time = std::chrono::steady_clock::time_point{
+            std::chrono::seconds{seconds} +
+            std::chrono::microseconds{microseconds}};
+    };
+    context.page_flip_handler = [](int,
+                                   unsigned int,
+                                   unsigned int seconds,
+                                   unsigned int microseconds,
+                                   void* data)
+    {
+        AtomicModeset::handleFlip(
+            data,
+            std::chrono::steady_clock::time_point{
+                std::chrono::seconds{seconds} +
+                std::chrono::microseconds{microseconds}});
+    };
+
+    if (drmHandleEvent(m_fd.fd(), &context) != 0)
+    {
+        return false;
     }
 
-    return true;
+    return m_vblank.received;
 }
 
 //-------------------------------------------------------------------------
 
-bool
-ogsfb32::FrameBuffer8880:: putImagePartial(
+void
+ogsfb32::FrameBuffer8880:: addDamage(
     const FB8880Point& p,
-    const Image8880& image) const
+    int32_t width,
+    int32_t height) const
 {
-    auto x = p.x();
-    auto xStart = 0;
-    auto xEnd = image.getWidth() - 1;
+    // Damage is kept in the coordinates of the rotated display, which is
+    // how the frame buffer is laid out.
+
+    const int32_t displayWidth = m_height;
+    const int32_t displayHeight = m_width;
 
-    auto y = p.y();
-    auto yStart = 0;
-    auto yEnd = image.getHeight() - 1;
+    const int32_t x = p.y();
+    const int32_t y = m_width - p.x() - width;
 
-    if (x < 0)
+    Damage damage{ std::max(x, 0),
+                   std::max(y, 0),
+                   std::min(x + height, displayWidth),
+                   std::min(y + width, displayHeight) };
+
+    if ((damage.x1 < damage.x2) and (damage.y1 < damage.y2))
     {
-        xStart = -x;
-        x = 0;
+        m_damage.push_back(damage);
     }
+}
+
+//-------------------------------------------------------------------------
 
-    if ((x - xStart + image.getWidth()) >
-        static_cast<int32_t>(m_width))
+bool
+ogsfb32::FrameBuffer8880:: present() const
+{
+    if (m_recorder and not m_damage.empty())
     {
-        xEnd = m_height - 1 - (x - xStart);
+        m_recorder->addFrame(m_fbp,
+                             m_lineLengthPixels,
+                             m_damage,
+                             std::chrono::steady_clock::now());
     }
 
-    if (y < 0)
+    if (isInMemory())
     {
-        yStart = -y;
-        y = 0;
+        for (auto& damage : m_damage)
+        {
+            damage = flush(damage);
+        }
     }
 
-    if ((y - yStart + image.getHeight()) >
-        static_cast<int32_t>(m_height))
+    if (m_atomic)
     {
-        yEnd = m_height - 1 - (y - yStart);
+        for (const auto& damage : m_damage)
+        {
+            m_atomic->addDamage(drm_mode_rect{ damage.x1,
+                                               damage.y1,
+                                               damage.x2,
+                                               damage.y2 });
+        }
+
+        m_damage.clear();
+
+        return m_atomic->commit();
     }
 
-    if ((xEnd - xStart) <= 0)
+    if (m_damage.empty())
     {
         return false;
     }
 
-    if ((yEnd - yStart) <= 0)
+    m_clips.clear();
+
+    for (const auto& damage : m_damage)
+    {
+        m_clips.push_back(drmModeClip{ static_cast<unsigned short>(damage.x1),
+                                     static_cast<unsigned short>(damage.y1),
+                                     static_cast<unsigned short>(damage.x2),
+                                     static_cast<unsigned short>(damage.y2) });
+    }
+
+    m_damage.clear();
+
+    return drmModeDirtyFB(m_fd.fd(), m_fbId, m_clips.data(), m_clips.size()) == 0;
+}
+
+//-------------------------------------------------------------------------
+
+ogsfb32::Image8880
+ogsfb32::FrameBuffer8880:: capture() const
+{
+    ProfileScope profileScope{"capture"};
+
+    const int32_t width = (m_rotated) ? m_mode.height : m_mode.width;
+    const int32_t height = (m_rotated) ? m_mode.width : m_mode.height;
+
+    std::vector<uint32_t> buffer(width * height);
+
+    if (m_rotated)
+    {
+        // Each line of the display is a column of the screen, which is how
+        // an image is laid out too.
+
+        for (int32_t line = 0 ; line < width ; ++line)
+        {
+            std::memcpy(buffer.data() + (line * height),
+                        m_dumbBuffer + (line * m_dumbLineLengthPixels),
+                        height * bytesPerPixel);
+        }
+    }
+    else
+    {
+        for (int32_t y = 0 ; y < height ; ++y)
+        {
+            const uint32_t* row = m_dumbBuffer + (y * m_dumbLineLengthPixels);
+
+            for (int32_t x = 0 ; x < width ; ++x)
+            {
+                buffer[((width - 1 - x) * height) + y] = row[x];
+            }
+        }
+    }
+
+    return Image8880(width, height, buffer);
+}
+
+//-------------------------------------------------------------------------
+
+const ogsfb32::FrameRecorder&
+ogsfb32::FrameBuffer8880:: startRecording(
+    const std::string& filename,
+    uint32_t frameRate)
+{
+    m_recorder.reset();
+    m_recorder = std::make_unique<FrameRecorder>(
+        filename,
+        m_width,
+        m_height,
+        (frameRate != 0) ? frameRate : m_mode.refresh);
+
+    return *m_recorder;
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::FrameBuffer8880:: stopRecording()
+{
+    m_recorder.reset();
+}
+
+//-------------------------------------------------------------------------
+
+bool
+ogsfb32::FrameBuffer8880:: putImage(
+    const FB8880Point& p,
+    const ConstImageView8880& image) const
+{
+    ProfileScope profileScope{"putImage"};
+
+    // Only the part of the image that is on the screen is drawn.
+
+    const int32_t x1 = std::max(p.x(), 0);
+    const int32_t y1 = std::max(p.y(), 0);
+    const int32_t x2 = std::min(p.x() + image.getWidth(), static_cast<int32_t>(m_width));
+    const int32_t y2 = std::min(p.y() + image.getHeight(), static_cast<int32_t>(m_height));
+
+    if ((x1 >= x2) or (y1 >= y2))
     {
         return false;
     }
 
-    for (auto i = xStart ; i <= xEnd ; ++i)
+    const auto part = image.subView(Image8880Point(x1 - p.x(), y1 - p.y()),
+                                    x2 - x1,
+                                    y2 - y1);
+
+    if (part.getOrientation() == ImageOrientation::ROWS)
+    {
+        transformImage(part,
+                       getView().subView(Image8880Point(x1, y1),
+                                         part.getWidth(),
+                                         part.getHeight()));
+
+        return true;
+    }
+
+    // The lines of both start from the right hand side.
+
+    for (int16_t i = 0 ; i < part.getWidth() ; ++i)
     {
-        auto start = image.getColumn(i) + yStart;
+        const uint32_t* start = part.getColumn(i);
 
         std::copy(start,
-                  start + (yEnd - yStart + 1),
-                  m_fbp + ((i+x) * m_lineLengthPixels) + y);
+                  start + part.getHeight(),
+                  m_fbp + ((m_width - x2 + i) * m_lineLengthPixels) + y1);
     }
 
     return true;
@@ -405,3 +1072,73 @@ ogsfb32::FrameBuffer8880:: offset(
 {
     return p.y() + (m_width - 1 - p.x()) * m_lineLengthPixels;
 }
+
+//-------------------------------------------------------------------------
+
+ogsfb32::FrameBuffer8880::Damage
+ogsfb32::FrameBuffer8880:: flush(
+    const Damage& damage) const
+{
+    ProfileScope profileScope{"flush"};
+
+    const uint32_t* source = m_fbp;
+    int32_t sourceStride = m_lineLengthPixels;
+    Damage area = damage;
+
+    if (m_scaler)
+    {
+        if (m_rotated)
+        {
+            return m_scaler->scale(m_fbp,
+                                   m_lineLengthPixels,
+                                   m_dumbBuffer,
+                                   m_dumbLineLengthPixels,
+                                   damage);
+        }
+
+        source = m_scaledBuffer.data();
+        sourceStride = m_mode.height;
+        area = m_scaler->scale(m_fbp,
+                               m_lineLengthPixels,
+                               m_scaledBuffer.data(),
+                               sourceStride,
+                               damage);
+    }
+    else if (m_rotated)
+    {
+        // Lines of the display are contiguous in both buffers, so each line
+        // of the damage is one sequential copy. memcpy() does these with
+        // the widest stores the processor has, which is what the uncached
+        // memory of the screen wants.
+
+        const size_t length = (damage.x2 - damage.x1) * bytesPerPixel;
+
+        for (int32_t y = damage.y1 ; y < damage.y2 ; ++y)
+        {
+            std::memcpy(m_dumbBuffer + (y * m_dumbLineLengthPixels) + damage.x1,
+                        m_fbp + (y * m_lineLengthPixels) + damage.x1,
+                        length);
+        }
+
+        return damage;
+    }
+
+    // The display isn't rotated, so the lines in memory are its columns.
+    // It is written a row at a time to keep the stores to it sequential.
+
+    const int32_t width = m_mode.width;
+    const int32_t x1 = width - area.y2;
+    const int32_t x2 = width - area.y1;
+
+    for (int32_t y = area.x1 ; y < area.x2 ; ++y)
+    {
+        uint32_t* row = m_dumbBuffer + (y * m_dumbLineLengthPixels);
+
+        for (int32_t x = x1 ; x < x2 ; ++x)
+        {
+            row[x] = source[((width - 1 - x) * sourceStride) + y];
+        }
+    }
+
+    return Damage{ x1, area.x1, x2, area.x2 };
+}
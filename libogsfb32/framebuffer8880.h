@@ -29,13 +29,22 @@
 
 //-------------------------------------------------------------------------
 
+#include <chrono>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "point.h"
 #include "fileDescriptor.h"
+#include "imageView8880.h"
 #include "rgb8880.h"
+#include "scaler.h"
+
+//-------------------------------------------------------------------------
+
+struct drm_clip_rect;
 
 //-------------------------------------------------------------------------
 
@@ -48,6 +57,8 @@ using FB8880Point = Point<int32_t>;
 
 //-------------------------------------------------------------------------
 
+class AtomicModeset;
+class FrameRecorder;
 class Image8880;
 
 //-------------------------------------------------------------------------
@@ -58,7 +69,66 @@ public:
 
     static constexpr size_t bytesPerPixel{4};
 
+    // A display mode of the connector. The width and height are those of
+    // the display, which is rotated from the screen.
+
+    struct Mode
+    {
+        int32_t width;
+        int32_t height;
+        uint32_t refresh;
+        bool preferred;
+    };
+
+    // A connected connector, named as the kernel names it (e.g. DSI-1 or
+    // HDMI-A-1), and a CRTC that is free to drive it. Each display can
+    // have its own frame buffer.
+
+    struct Display
+    {
+        std::string name;
+        uint32_t connectorId;
+        uint32_t crtcId;
+        uint32_t crtcIndex;
+        bool builtIn;
+    };
+
+    // The display is chosen by connector name, or if none is given a
+    // built in panel is used before anything plugged in.
+    //
+    // The mode is chosen by width, height and refresh, where 0 matches
+    // anything. Of the matching modes the one with the closest refresh
+    // is used, then the preferred one. If none are given the current mode
+    // is kept.
+    //
+    // Giving a render width and height, in screen coordinates, draws into
+    // memory at that resolution instead, which present() scales to the
+    // screen with the filter.
+    //
+    // The screen's memory is usually uncached, so reading it back is slow
+    // and scattered writes waste bandwidth. A shadow draws into a copy of
+    // the screen in cached memory, and present() copies it to the screen.
+
+    struct Options
+    {
+        std::string connector{};
+        int32_t width{0};
+        int32_t height{0};
+        uint32_t refresh{0};
+        int32_t renderWidth{0};
+        int32_t renderHeight{0};
+        Scaler::Filter filter{Scaler::NEAREST};
+        bool shadow{false};
+    };
+
     explicit FrameBuffer8880(const std::string& device);
+    FrameBuffer8880(const std::string& device, const Options& options);
+
+    // Frame buffers for more than one display have to share the device,
+    // as only the file that opened it first can set modes. They share its
+    // events too, which handleEvents() on any of them will read.
+
+    FrameBuffer8880(const FileDescriptor& device, const Options& options);
 
     ~FrameBuffer8880();
 
@@ -71,6 +141,27 @@ public:
     int32_t getWidth() const { return m_width; }
     int32_t getHeight() const { return m_height; }
 
+    const Mode& getMode() const { return m_mode; }
+    const std::string& getName() const { return m_name; }
+    bool isScaled() const { return static_cast<bool>(m_scaler); }
+    bool isInMemory() const { return not m_renderBuffer.empty(); }
+
+    // A built in panel is usually mounted on its side, so its display is
+    // rotated from the screen. Landscape displays, like a monitor, are
+    // not, and are drawn in memory and turned when they are presented.
+
+    bool isRotated() const { return m_rotated; }
+
+    static std::vector<Display> getDisplays(const FileDescriptor& device);
+    static std::vector<Display> getDisplays(const std::string& device);
+
+    // The modes of the connector the frame buffer would use.
+
+    static std::vector<Mode>
+    getModes(
+        const std::string& device,
+        const std::string& connector = "");
+
     void clear(const RGB8880& rgb) const { clear(rgb.get8880()); }
     void clear(uint32_t rgb = 0) const;
 
@@ -87,14 +178,105 @@ public:
     std::pair<bool, RGB8880> getPixelRGB(const FB8880Point& p) const;
     std::pair<bool, uint32_t> getPixel(const FB8880Point& p) const;
 
-    bool putImage(const FB8880Point& p, const Image8880& image) const;
+    // Images, and views of them, convert to a ConstImageView8880.
+
+    bool putImage(const FB8880Point& p, const ConstImageView8880& image) const;
+
+    // The display is rotated, so each screen column is a line of the
+    // frame buffer. Returns the pixel at the top of column x, or nullptr
+    // if x is off the screen.
+
+    uint32_t* getColumn(int32_t x) const;
+
+    // A view of the screen, for drawing on it with the image primitives.
+    // Whatever is drawn has to be added to the damage.
+
+    ImageView8880 getView() const;
+
+    // The DRM device, which becomes readable when a requested vertical
+    // blank event arrives. requestVblankEvent() returns false if the
+    // driver can't deliver them. handleEvents() reads the pending events
+    // and returns true if one was a vertical blank; page flip events
+    // from present() are handled too. The sequence number
+    // and time of the last vertical blank event are kept; the time is on
+    // CLOCK_MONOTONIC, the clock of std::chrono::steady_clock.
+
+    int getFd() const { return m_fd.fd(); }
+    const FileDescriptor& getFileDescriptor() const { return m_fd; }
+    bool requestVblankEvent() const;
+    bool handleEvents() const;
+
+    // The CRTC showing the frame buffer, for placing planes on it.
+
+    uint32_t getCrtcId() const { return m_crtcId; }
+    uint32_t getCrtcIndex() const { return m_crtcIndex; }
+
+    // Atomic modesetting is used where the driver supports it, in which
+    // case plane changes are staged and only shown by present().
+    // Otherwise this returns nullptr and planes change immediately.
+
+    AtomicModeset* getAtomic() const { return m_atomic.get(); }
+
+    // Drawing goes straight to the screen, but some displays only update
+    // the areas they are told have changed. present() sends the damaged
+    // areas, and with atomic modesetting any staged plane changes, in one
+    // non-blocking commit. It returns true if anything was sent. A commit
+    // completes with a page flip event, which has to be read by
+    // handleEvents() before the next one can be sent.
+    //
+    // When drawing in memory, it only reaches the screen when present()
+    // copies or scales the damaged areas to it. addDamage() with no area
+    // damages the whole screen, as clear() does. hasDamage() is true if
+    // anything has been damaged since the last present(). Damage that has
+    // not been presented when the frame buffer is destroyed is presented
+    // then.
+
+    void addDamage() const { addDamage(FB8880Point{ 0, 0 }, m_width, m_height); }
+    void addDamage(const FB8880Point& p, int32_t width, int32_t height) const;
+    bool hasDamage() const { return not m_damage.empty(); }
+    bool present() const;
+
+    // A copy of the display as it is shown, turned upright, at the
+    // resolution of its mode. It is read back from the screen, so it is
+    // slow, and planes placed over the screen aren't included.
+
+    Image8880 capture() const;
+
+    // Records each frame present() sends to a Y4M video file, at the
+    // resolution it is drawn and at frameRate, or the refresh of the mode
+    // if 0. Only the damaged areas are copied, which is a fraction of the
+    // cost of a flush when drawing in memory, but reads back the slow
+    // memory of the screen otherwise. Returns the recorder, which counts
+    // the frames it had to drop.
+
+    const FrameRecorder&
+    startRecording(
+        const std::string& filename,
+        uint32_t frameRate = 0);
+
+    void stopRecording();
+    bool isRecording() const { return static_cast<bool>(m_recorder); }
+
+    uint32_t getVblankSequence() const { return m_vblank.sequence; }
+
+    std::chrono::steady_clock::time_point
+    getVblankTime() const
+    {
+        return m_vblank.time;
+    }
 
 private:
 
-    bool
-    putImagePartial(
-        const FB8880Point& p,
-        const Image8880& image) const;
+    using Damage = Scaler::Area;
+
+    FrameBuffer8880(int ownedDevice, const Options& options);
+
+    struct Vblank
+    {
+        bool received;
+        uint32_t sequence;
+        std::chrono::steady_clock::time_point time;
+    };
 
     bool
     validPixel(const FB8880Point& p) const
@@ -107,15 +289,33 @@ private:
 
     size_t offset(const FB8880Point& p) const;
 
+    Damage flush(const Damage& damage) const;
+
     uint32_t m_width;
     uint32_t m_height;
     uint32_t m_length;
     int32_t m_lineLengthPixels;
 
     FileDescriptor m_fd;
+    std::string m_name;
+    Mode m_mode;
+    bool m_rotated;
+    uint32_t m_crtcId;
+    uint32_t m_crtcIndex;
+    mutable Vblank m_vblank;
+    std::unique_ptr<AtomicModeset> m_atomic;
+    mutable std::vector<Damage> m_damage;
+    mutable std::vector<struct drm_clip_rect> m_clips;
     uint32_t* m_fbp;
     uint32_t m_fbId;
     uint32_t m_fbHandle;
+    uint32_t* m_dumbBuffer;
+    uint32_t m_dumbLength;
+    int32_t m_dumbLineLengthPixels;
+    std::vector<uint32_t> m_renderBuffer;
+    mutable std::vector<uint32_t> m_scaledBuffer;
+    std::unique_ptr<Scaler> m_scaler;
+    std::unique_ptr<FrameRecorder> m_recorder;
 };
 
 //-------------------------------------------------------------------------
@@ -0,0 +1,115 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <sys/socket.h>
+#include <linux/netlink.h>
+
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <string_view>
+#include <system_error>
+
+#include "hotplugMonitor.h"
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+
+// Kernel uevents are sent to this group; udev rebroadcasts them to
+// another once it has processed them.
+
+constexpr uint32_t kernelEvents = 1;
+
+}
+
+//-------------------------------------------------------------------------
+
+ogsfb32::HotplugMonitor:: HotplugMonitor()
+:
+    m_fd{::socket(AF_NETLINK,
+                  SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC,
+                  NETLINK_KOBJECT_UEVENT)}
+{
+    if (m_fd.fd() == -1)
+    {
+        throw std::system_error{errno,
+                                std::system_category(),
+                                "cannot create uevent socket"};
+    }
+
+    struct sockaddr_nl address{};
+    address.nl_family = AF_NETLINK;
+    address.nl_groups = kernelEvents;
+
+    if (::bind(m_fd.fd(),
+               reinterpret_cast<struct sockaddr*>(&address),
+               sizeof(address)) == -1)
+    {
+        throw std::system_error{errno,
+                                std::system_category(),
+                                "cannot bind uevent socket"};
+    }
+}
+
+//-------------------------------------------------------------------------
+
+bool
+ogsfb32::HotplugMonitor:: read()
+{
+    bool hotplug = false;
+    std::array<char, 8192> buffer;
+
+    ssize_t length = 0;
+
+    while ((length = ::recv(m_fd.fd(), buffer.data(), buffer.size(), 0)) > 0)
+    {
+        // A uevent is ACTION@DEVPATH followed by KEY=VALUE strings, each
+        // terminated by a null.
+
+        bool drm = false;
+        bool changed = false;
+
+        for (size_t offset = 0 ; offset < static_cast<size_t>(length) ; )
+        {
+            const std::string_view field{buffer.data() + offset,
+                                         ::strnlen(buffer.data() + offset,
+                                                   length - offset)};
+
+            drm = drm or (field == "SUBSYSTEM=drm");
+            changed = changed or (field == "HOTPLUG=1");
+
+            offset += field.size() + 1;
+        }
+
+        hotplug = hotplug or (drm and changed);
+    }
+
+    return hotplug;
+}
@@ -86,6 +86,22 @@ ogsfb32::Image8880:: Image8880(
 
 //-------------------------------------------------------------------------
 
+ogsfb32::Image8880:: Image8880(
+    int16_t width,
+    int16_t height,
+    const uint32_t* buffer,
+    uint8_t numberOfFrames)
+:
+    m_width{width},
+    m_height{height},
+    m_frame{0},
+    m_numberOfFrames{numberOfFrames},
+    m_buffer(buffer, buffer + (width * height * numberOfFrames))
+{
+}
+
+//-------------------------------------------------------------------------
+
 void
 ogsfb32::Image8880:: setFrame(
     uint8_t frame)
@@ -176,6 +192,28 @@ ogsfb32::Image8880:: getColumn(
 
 //-------------------------------------------------------------------------
 
+ogsfb32::ImageView8880
+ogsfb32::Image8880:: getView()
+{
+    return ImageView8880(m_buffer.data() + (m_width * m_height * m_frame),
+                         m_width,
+                         m_height,
+                         m_height);
+}
+
+//-------------------------------------------------------------------------
+
+ogsfb32::ConstImageView8880
+ogsfb32::Image8880:: getView() const
+{
+    return ConstImageView8880(m_buffer.data() + (m_width * m_height * m_frame),
+                              m_width,
+                              m_height,
+                              m_height);
+}
+
+//-------------------------------------------------------------------------
+
 size_t
 ogsfb32::Image8880:: offset(
     const Image8880Point& p) const
@@ -34,6 +34,7 @@
 #include <utility>
 #include <vector>
 
+#include "imageView8880.h"
 #include "rgb8880.h"
 #include "point.h"
 
@@ -44,10 +45,6 @@ namespace ogsfb32
 
 //-------------------------------------------------------------------------
 
-using Image8880Point = Point<int16_t>;
-
-//-------------------------------------------------------------------------
-
 class Image8880
 {
 public:
@@ -59,6 +56,13 @@ public:
               const std::vector<uint32_t>& buffer,
               uint8_t numberOfFrames = 1);
 
+    // Copies the frames from an array of them, such as constant image data.
+
+    Image8880(int16_t width,
+              int16_t height,
+              const uint32_t* buffer,
+              uint8_t numberOfFrames = 1);
+
     Image8880(const Image8880&) = default;
     Image8880& operator=(const Image8880&) = default;
 
@@ -87,6 +91,15 @@ public:
 
     const uint32_t* getColumn(int16_t x) const;
 
+    // Views of the current frame, which images convert to wherever one
+    // is taken.
+
+    ImageView8880 getView();
+    ConstImageView8880 getView() const;
+
+    operator ImageView8880() { return getView(); }
+    operator ConstImageView8880() const { return getView(); }
+
 private:
 
     bool
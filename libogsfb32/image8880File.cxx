@@ -0,0 +1,319 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <fstream>
+#include <system_error>
+#include <vector>
+
+#include "image8880File.h"
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+
+//-------------------------------------------------------------------------
+
+std::ofstream
+openFile(
+    const std::string& filename)
+{
+    std::ofstream file{filename, std::ios::binary | std::ios::trunc};
+
+    if (not file)
+    {
+        throw std::system_error{errno,
+                                std::system_category(),
+                                "cannot open " + filename};
+    }
+
+    return file;
+}
+
+//-------------------------------------------------------------------------
+
+void
+closeFile(
+    std::ofstream& file,
+    const std::string& filename)
+{
+    file.close();
+
+    if (not file)
+    {
+        throw std::system_error{errno,
+                                std::system_category(),
+                                "cannot write " + filename};
+    }
+}
+
+//-------------------------------------------------------------------------
+
+// The image in rows from the top, three bytes of red, green and blue per
+// pixel. Each row is preceded by filter bytes if there are any.
+
+std::vector<uint8_t>
+toRows(
+    const ogsfb32::ConstImageView8880& image,
+    size_t filterBytes)
+{
+    const int16_t width = image.getWidth();
+    const int16_t height = image.getHeight();
+
+    std::vector<uint8_t> rows;
+    rows.reserve((filterBytes + (width * 3)) * height);
+
+    for (int16_t y = 0 ; y < height ; ++y)
+    {
+        rows.insert(rows.end(), filterBytes, 0);
+
+        for (int16_t x = 0 ; x < width ; ++x)
+        {
+            const uint32_t rgb = image.getPixel(ogsfb32::Image8880Point(x, y)).second;
+
+            rows.push_back((rgb >> 16) & 0xFF);
+            rows.push_back((rgb >> 8) & 0xFF);
+            rows.push_back(rgb & 0xFF);
+        }
+    }
+
+    return rows;
+}
+
+//-------------------------------------------------------------------------
+
+uint32_t
+crc32(
+    const uint8_t* data,
+    size_t length,
+    uint32_t crc = 0)
+{
+    static const auto table = []
+    {
+        std::array<uint32_t, 256> table;
+
+        for (uint32_t n = 0 ; n < table.size() ; ++n)
+        {
+            uint32_t c = n;
+
+            for (int k = 0 ; k < 8 ; ++k)
+            {
+                c = (c & 1) ? (0xEDB88320 ^ (c >> 1)) : (c >> 1);
+            }
+
+            table[n] = c;
+        }
+
+        return table;
+    }();
+
+    crc = ~crc;
+
+    for (size_t i = 0 ; i < length ; ++i)
+    {
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+
+    return ~crc;
+}
+
+//-------------------------------------------------------------------------
+
+uint32_t
+adler32(
+    const std::vector<uint8_t>& data)
+{
+    constexpr uint32_t modulus = 65521;
+
+    // The sums can't overflow in this many bytes before they are reduced.
+
+    constexpr size_t block = 5552;
+
+    uint32_t a = 1;
+    uint32_t b = 0;
+
+    for (size_t start = 0 ; start < data.size() ; start += block)
+    {
+        const size_t end = std::min(start + block, data.size());
+
+        for (size_t i = start ; i < end ; ++i)
+        {
+            a += data[i];
+            b += a;
+        }
+
+        a %= modulus;
+        b %= modulus;
+    }
+
+    return (b << 16) | a;
+}
+
+//-------------------------------------------------------------------------
+
+void
+putBigEndian(
+    std::vector<uint8_t>& data,
+    uint32_t value)
+{
+    data.push_back(value >> 24);
+    data.push_back((value >> 16) & 0xFF);
+    data.push_back((value >> 8) & 0xFF);
+    data.push_back(value & 0xFF);
+}
+
+//-------------------------------------------------------------------------
+
+void
+writeChunk(
+    std::ofstream& file,
+    const char* type,
+    const std::vector<uint8_t>& data)
+{
+    std::vector<uint8_t> chunk;
+    chunk.reserve(data.size() + 12);
+
+    putBigEndian(chunk, data.size());
+    chunk.insert(chunk.end(), type, type + 4);
+    chunk.insert(chunk.end(), data.begin(), data.end());
+    putBigEndian(chunk, crc32(chunk.data() + 4, chunk.size() - 4));
+
+    file.write(reinterpret_cast<const char*>(chunk.data()), chunk.size());
+}
+
+//-------------------------------------------------------------------------
+
+// A zlib stream of stored deflate blocks, which hold the data as it is.
+
+std::vector<uint8_t>
+storedZlib(
+    const std::vector<uint8_t>& data)
+{
+    constexpr size_t maxBlock = 65535;
+
+    std::vector<uint8_t> stream{ 0x78, 0x01 };
+    stream.reserve(data.size() + ((data.size() / maxBlock) + 1) * 5 + 6);
+
+    size_t start = 0;
+
+    do
+    {
+        const size_t length = std::min(maxBlock, data.size() - start);
+        const bool final = (start + length) == data.size();
+
+        stream.push_back((final) ? 1 : 0);
+        stream.push_back(length & 0xFF);
+        stream.push_back(length >> 8);
+        stream.push_back(~length & 0xFF);
+        stream.push_back((~length >> 8) & 0xFF);
+        stream.insert(stream.end(),
+                      data.begin() + start,
+                      data.begin() + start + length);
+
+        start += length;
+    }
+    while (start < data.size());
+
+    putBigEndian(stream, adler32(data));
+
+    return stream;
+}
+
+//-------------------------------------------------------------------------
+
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::writePpm(
+    const ConstImageView8880& image,
+    const std::string& filename)
+{
+    auto file = openFile(filename);
+
+    file << "P6\n"
+         << image.getWidth() << " " << image.getHeight() << "\n"
+         << "255\n";
+
+    const auto rows = toRows(image, 0);
+    file.write(reinterpret_cast<const char*>(rows.data()), rows.size());
+
+    closeFile(file, filename);
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::writePng(
+    const ConstImageView8880& image,
+    const std::string& filename)
+{
+    auto file = openFile(filename);
+
+    static constexpr char signature[] = "\x89PNG\r\n\x1a\n";
+    file.write(signature, sizeof(signature) - 1);
+
+    // 8 bits per sample, RGB, no interlace.
+
+    std::vector<uint8_t> header;
+    putBigEndian(header, image.getWidth());
+    putBigEndian(header, image.getHeight());
+    header.insert(header.end(), { 8, 2, 0, 0, 0 });
+
+    writeChunk(file, "IHDR", header);
+    writeChunk(file, "IDAT", storedZlib(toRows(image, 1)));
+    writeChunk(file, "IEND", {});
+
+    closeFile(file, filename);
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::writeImage(
+    const ConstImageView8880& image,
+    const std::string& filename)
+{
+    const std::string ppm{".ppm"};
+
+    if ((filename.size() >= ppm.size()) and
+        (filename.compare(filename.size() - ppm.size(), ppm.size(), ppm) == 0))
+    {
+        writePpm(image, filename);
+    }
+    else
+    {
+        writePng(image, filename);
+    }
+}
+
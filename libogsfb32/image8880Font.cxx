@@ -4846,7 +4846,7 @@ ogsfb32::drawBattery(
     const Image8880Point& p,
     uint16_t percent,
     uint32_t rgb,
-    Image8880& image)
+    const ImageView8880& image)
 {
     auto index = std::min(9, (percent / 10));
 
@@ -4878,7 +4878,7 @@ ogsfb32::drawChar(
     const Image8880Point& p,
     uint8_t c,
     const RGB8880& rgb,
-    Image8880& image)
+    const ImageView8880& image)
 {
     return drawChar(p, c, rgb.get8880(), image);
 }
@@ -4890,7 +4890,7 @@ ogsfb32::drawChar(
     const Image8880Point& p,
     uint8_t c,
     uint32_t rgb,
-    Image8880& image)
+    const ImageView8880& image)
 {
     for (int16_t j = 0 ; j < sc_fontHeight ; ++j)
     {
@@ -4918,21 +4918,9 @@ ogsfb32::drawChar(
 ogsfb32::FontPoint
 ogsfb32::drawString(
     const Image8880Point& p,
-    const char* string,
+    std::string_view string,
     const RGB8880& rgb,
-    Image8880& image)
-{
-    return drawString(p, std::string(string), rgb, image);
-}
-
-//-------------------------------------------------------------------------
-
-ogsfb32::FontPoint
-ogsfb32::drawString(
-    const Image8880Point& p,
-    const std::string& string,
-    const RGB8880& rgb,
-    Image8880& image)
+    const ImageView8880& image)
 {
     FontPoint position{p};
     FontPoint start{p};
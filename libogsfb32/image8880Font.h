@@ -31,7 +31,7 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <string>
+#include <string_view>
 
 #include "image8880.h"
 #include "point.h"
@@ -61,35 +61,28 @@ drawBattery(
     const Image8880Point& p,
     uint16_t percent,
     uint32_t rgb,
-    Image8880& image);
+    const ImageView8880& image);
 
 FontPoint
 drawChar(
     const Image8880Point& p,
     uint8_t c,
     const RGB8880& rgb,
-    Image8880& image);
+    const ImageView8880& image);
 
 FontPoint
 drawChar(
     const Image8880Point& p,
     uint8_t c,
     uint32_t rgb,
-    Image8880& image);
+    const ImageView8880& image);
 
 FontPoint
 drawString(
     const Image8880Point& p,
-    const char* string,
+    std::string_view string,
     const RGB8880& rgb,
-    Image8880& image);
-
-FontPoint
-drawString(
-    const Image8880Point& p,
-    const std::string& string,
-    const RGB8880& rgb,
-    Image8880& image);
+    const ImageView8880& image);
 
 //-------------------------------------------------------------------------
 
@@ -37,7 +37,7 @@
 void
 ogsfb32::
 box(
-    Image8880& image,
+    const ImageView8880& image,
     const Image8880Point& p1,
     const Image8880Point& p2,
     uint32_t rgb)
@@ -53,7 +53,7 @@ box(
 void
 ogsfb32::
 boxFilled(
-    Image8880& image,
+    const ImageView8880& image,
     const Image8880Point& p1,
     const Image8880Point& p2,
     uint32_t rgb)
@@ -75,7 +75,7 @@ boxFilled(
 void
 ogsfb32::
 line(
-    Image8880& image,
+    const ImageView8880& image,
     const Image8880Point& p1,
     const Image8880Point& p2,
     uint32_t rgb)
@@ -155,7 +155,7 @@ line(
 void
 ogsfb32::
 horizontalLine(
-    Image8880& image,
+    const ImageView8880& image,
     int16_t x1,
     int16_t x2,
     int16_t y,
@@ -178,7 +178,7 @@ horizontalLine(
 void
 ogsfb32::
 verticalLine(
-    Image8880& image,
+    const ImageView8880& image,
     int16_t x,
     int16_t y1,
     int16_t y2,
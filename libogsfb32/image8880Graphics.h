@@ -44,14 +44,14 @@ namespace ogsfb32
 
 void
 box(
-    Image8880& image,
+    const ImageView8880& image,
     const Image8880Point& p1,
     const Image8880Point& p2,
     uint32_t rgb);
 
 inline void
 box(
-    Image8880& image,
+    const ImageView8880& image,
     const Image8880Point& p1,
     const Image8880Point& p2,
     const RGB8880& rgb)
@@ -63,14 +63,14 @@ box(
 
 void
 boxFilled(
-    Image8880& image,
+    const ImageView8880& image,
     const Image8880Point& p1,
     const Image8880Point& p2,
     uint32_t rgb);
 
 inline void
 boxFilled(
-    Image8880& image,
+    const ImageView8880& image,
     const Image8880Point& p1,
     const Image8880Point& p2,
     const RGB8880& rgb)
@@ -82,14 +82,14 @@ boxFilled(
 
 void
 line(
-    Image8880& image,
+    const ImageView8880& image,
     const Image8880Point& p1,
     const Image8880Point& p2,
     uint32_t rgb);
 
 inline void
 line(
-    Image8880& image,
+    const ImageView8880& image,
     const Image8880Point& p1,
     const Image8880Point& p2,
     const RGB8880& rgb)
@@ -101,7 +101,7 @@ line(
 
 void
 horizontalLine(
-    Image8880& image,
+    const ImageView8880& image,
     int16_t x1,
     int16_t x2,
     int16_t y,
@@ -109,7 +109,7 @@ horizontalLine(
 
 inline void
 horizontalLine(
-    Image8880& image,
+    const ImageView8880& image,
     int16_t x1,
     int16_t x2,
     int16_t y,
@@ -122,7 +122,7 @@ horizontalLine(
 
 void
 verticalLine(
-    Image8880& image,
+    const ImageView8880& image,
     int16_t x,
     int16_t y1,
     int16_t y2,
@@ -130,7 +130,7 @@ verticalLine(
 
 inline void
 verticalLine(
-    Image8880& image,
+    const ImageView8880& image,
     int16_t x,
     int16_t y1,
     int16_t y2,
@@ -0,0 +1,309 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "image8880Transform.h"
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+
+//-------------------------------------------------------------------------
+
+// A tile of 16 x 16 pixels is 1kB of source and 1kB of destination, which
+// both stay in the level 1 cache while a tile is copied.
+
+constexpr int32_t tileSize{16};
+
+//-------------------------------------------------------------------------
+
+template<typename VIEW>
+bool
+isColumns(
+    const VIEW& view)
+{
+    return view.getOrientation() == ogsfb32::ImageOrientation::COLUMNS;
+}
+
+//-------------------------------------------------------------------------
+
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::transformImage(
+    const ConstImageView8880& source,
+    const ImageView8880& destination,
+    ImageRotation rotation,
+    ImageFlip flip)
+{
+    const int32_t width = source.getWidth();
+    const int32_t height = source.getHeight();
+
+    const bool quarterTurn = (rotation == ImageRotation::ROTATE_90) or
+                             (rotation == ImageRotation::ROTATE_270);
+
+    const int32_t turnedWidth = (quarterTurn) ? height : width;
+    const int32_t turnedHeight = (quarterTurn) ? width : height;
+
+    const int32_t clipWidth = std::min<int32_t>(turnedWidth, destination.getWidth());
+    const int32_t clipHeight = std::min<int32_t>(turnedHeight, destination.getHeight());
+
+    if ((clipWidth <= 0) or (clipHeight <= 0))
+    {
+        return;
+    }
+
+    //---------------------------------------------------------------------
+
+    // Where the pixel at a line and index of the destination comes from in
+    // the source. Each step is linear, so the whole mapping is an offset
+    // plus a step for each line and each index.
+
+    auto sourceOffset = [&](int64_t line, int64_t index)
+    {
+        int64_t x = (isColumns(destination))
+                  ? destination.getWidth() - 1 - line
+                  : index;
+        int64_t y = (isColumns(destination)) ? index : line;
+
+        if (flip == ImageFlip::HORIZONTAL)
+        {
+            x = turnedWidth - 1 - x;
+        }
+        else if (flip == ImageFlip::VERTICAL)
+        {
+            y = turnedHeight - 1 - y;
+        }
+
+        int64_t sx = x;
+        int64_t sy = y;
+
+        switch (rotation)
+        {
+        case ImageRotation::ROTATE_90:
+
+            sx = y;
+            sy = height - 1 - x;
+
+            break;
+
+        case ImageRotation::ROTATE_180:
+
+            sx = width - 1 - x;
+            sy = height - 1 - y;
+
+            break;
+
+        case ImageRotation::ROTATE_270:
+
+            sx = width - 1 - y;
+            sy = x;
+
+            break;
+
+        default:
+
+            break;
+        }
+
+        return (isColumns(source))
+               ? sy + ((width - 1 - sx) * source.getStride())
+               : sx + (sy * source.getStride());
+    };
+
+    const int64_t origin = sourceOffset(0, 0);
+    const int64_t lineStep = sourceOffset(1, 0) - origin;
+    const int64_t indexStep = sourceOffset(0, 1) - origin;
+
+    //---------------------------------------------------------------------
+
+    const int32_t line1 = (isColumns(destination))
+                        ? destination.getWidth() - clipWidth
+                        : 0;
+    const int32_t line2 = line1 + ((isColumns(destination)) ? clipWidth : clipHeight);
+    const int32_t length = (isColumns(destination)) ? clipHeight : clipWidth;
+
+    const uint32_t* from = source.getBuffer();
+    uint32_t* to = destination.getBuffer();
+    const int32_t stride = destination.getStride();
+
+    if ((indexStep == 1) or (indexStep == -1))
+    {
+        for (int32_t line = line1 ; line < line2 ; ++line)
+        {
+            const uint32_t* start = from + (origin + (line * lineStep));
+
+            if (indexStep == 1)
+            {
+                std::copy(start, start + length, to + (line * stride));
+            }
+            else
+            {
+                std::reverse_copy(start - length + 1, start + 1, to + (line * stride));
+            }
+        }
+
+        return;
+    }
+
+    // The source is read across its lines, so go a tile at a time.
+
+    for (int32_t tileLine = line1 ; tileLine < line2 ; tileLine += tileSize)
+    {
+        const int32_t lineEnd = std::min(tileLine + tileSize, line2);
+
+        for (int32_t tileIndex = 0 ; tileIndex < length ; tileIndex += tileSize)
+        {
+            const int32_t indexEnd = std::min(tileIndex + tileSize, length);
+
+            for (int32_t line = tileLine ; line < lineEnd ; ++line)
+            {
+                const uint32_t* start = from + (origin + (line * lineStep));
+                uint32_t* pixels = to + (line * stride);
+
+                for (int32_t index = tileIndex ; index < indexEnd ; ++index)
+                {
+                    pixels[index] = start[index * indexStep];
+                }
+            }
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::scaleImage(
+    const ConstImageView8880& source,
+    const ImageView8880& destination,
+    Scaler::Filter filter)
+{
+    if ((source.getWidth() <= 0) or
+        (source.getHeight() <= 0) or
+        (destination.getWidth() <= 0) or
+        (destination.getHeight() <= 0))
+    {
+        return;
+    }
+
+    if (source.getOrientation() != destination.getOrientation())
+    {
+        const int32_t stride = (isColumns(destination))
+                             ? source.getHeight()
+                             : source.getWidth();
+
+        std::vector<uint32_t> buffer(source.getWidth() * source.getHeight());
+
+        const ImageView8880 converted(buffer.data(),
+                                      source.getWidth(),
+                                      source.getHeight(),
+                                      stride,
+                                      destination.getOrientation());
+
+        transformImage(source, converted);
+        scaleImage(converted, destination, filter);
+
+        return;
+    }
+
+    // Both are laid out the same way, so the lines of each can be scaled
+    // as if they were rows.
+
+    const bool columns = isColumns(source);
+
+    const int32_t sourceLength = (columns) ? source.getHeight() : source.getWidth();
+    const int32_t sourceLines = (columns) ? source.getWidth() : source.getHeight();
+    const int32_t length = (columns) ? destination.getHeight() : destination.getWidth();
+    const int32_t lines = (columns) ? destination.getWidth() : destination.getHeight();
+
+    Scaler scaler{sourceLength, sourceLines, length, lines, filter};
+
+    scaler.scale(source.getBuffer(),
+                 source.getStride(),
+                 destination.getBuffer(),
+                 destination.getStride(),
+                 Scaler::Area{ 0, 0, sourceLength, sourceLines });
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::expandPalette(
+    const uint8_t* indices,
+    const uint32_t* palette,
+    uint32_t* destination,
+    int32_t length,
+    int32_t repeat)
+{
+    if (repeat <= 1)
+    {
+        for (int32_t i = 0 ; i < length ; ++i)
+        {
+            destination[i] = palette[indices[i]];
+        }
+
+        return;
+    }
+
+    for (int32_t i = 0 ; i < length ; )
+    {
+        const int32_t end = std::min(i + repeat, length);
+
+        std::fill(destination + i, destination + end, palette[*(indices++)]);
+        i = end;
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::expandPalette(
+    const uint8_t* indices,
+    int32_t indexStride,
+    const uint32_t* palette,
+    const ImageView8880& destination)
+{
+    const bool columns = isColumns(destination);
+
+    const int32_t lines = (columns) ? destination.getWidth() : destination.getHeight();
+    const int32_t length = (columns) ? destination.getHeight() : destination.getWidth();
+
+    for (int32_t line = 0 ; line < lines ; ++line)
+    {
+        expandPalette(indices + (line * indexStride),
+                      palette,
+                      destination.getBuffer() + (line * destination.getStride()),
+                      length);
+    }
+}
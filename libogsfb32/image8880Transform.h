@@ -0,0 +1,115 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <cstdint>
+
+#include "imageView8880.h"
+#include "scaler.h"
+
+//-------------------------------------------------------------------------
+
+namespace ogsfb32
+{
+
+//-------------------------------------------------------------------------
+
+// Turns are clockwise as the image is seen on the display.
+
+enum class ImageRotation
+{
+    ROTATE_0,
+    ROTATE_90,
+    ROTATE_180,
+    ROTATE_270
+};
+
+enum class ImageFlip
+{
+    NONE,
+    HORIZONTAL,
+    VERTICAL
+};
+
+//-------------------------------------------------------------------------
+
+// Copies the source to the destination turned and then flipped. A
+// quarter turn swaps the width and height. The views can be in either
+// orientation, so this also converts between COLUMNS and ROWS. Anything
+// that does not fit in the destination is clipped. Lines that run the same
+// way are copied whole; otherwise the copy is done in small square tiles,
+// so that reading down the source stays in the cache.
+
+void
+transformImage(
+    const ConstImageView8880& source,
+    const ImageView8880& destination,
+    ImageRotation rotation = ImageRotation::ROTATE_0,
+    ImageFlip flip = ImageFlip::NONE);
+
+//-------------------------------------------------------------------------
+
+// Scales the whole of the source to fill the destination with a Scaler.
+// Views of different orientations are converted first, which needs a
+// copy of the source.
+
+void
+scaleImage(
+    const ConstImageView8880& source,
+    const ImageView8880& destination,
+    Scaler::Filter filter);
+
+//-------------------------------------------------------------------------
+
+// Writes length pixels, looking each index up in the palette and repeating
+// it repeat times, which scales the line up by a whole number.
+
+void
+expandPalette(
+    const uint8_t* indices,
+    const uint32_t* palette,
+    uint32_t* destination,
+    int32_t length,
+    int32_t repeat = 1);
+
+// Fills the destination from indices laid out in the same way, a line of
+// them every indexStride bytes.
+
+void
+expandPalette(
+    const uint8_t* indices,
+    int32_t indexStride,
+    const uint32_t* palette,
+    const ImageView8880& destination);
+
+//-------------------------------------------------------------------------
+
+} // namespace ogsfb32
@@ -0,0 +1,249 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "point.h"
+#include "rgb8880.h"
+
+//-------------------------------------------------------------------------
+
+namespace ogsfb32
+{
+
+//-------------------------------------------------------------------------
+
+using Image8880Point = Point<int16_t>;
+
+//-------------------------------------------------------------------------
+
+// How the pixels under a view are laid out. Images and the frame buffer
+// are in COLUMNS: each line is a column, from the right of the image to
+// the left, as the display is rotated. In ROWS each line is a row, from
+// the top, as most images are stored.
+
+enum class ImageOrientation
+{
+    COLUMNS,
+    ROWS
+};
+
+//-------------------------------------------------------------------------
+
+// A view of pixels that belong to something else, such as an Image8880,
+// the frame buffer or constant image data. The stride is the number of
+// pixels from the start of one line to the next, so a view can be of part
+// of a larger image. Copying a view copies no pixels, and the pixels have
+// to outlive it. ConstImageView8880 is a view that can't change them.
+
+template<typename PIXEL>
+class BasicImageView8880
+{
+public:
+
+    using Pixel = PIXEL;
+
+    BasicImageView8880() = default;
+
+    BasicImageView8880(
+        Pixel* buffer,
+        int16_t width,
+        int16_t height,
+        int32_t stride,
+        ImageOrientation orientation = ImageOrientation::COLUMNS)
+    :
+        m_buffer{buffer},
+        m_width{width},
+        m_height{height},
+        m_stride{stride},
+        m_orientation{orientation}
+    {
+    }
+
+    template<typename OTHER,
+             typename = std::enable_if_t<std::is_convertible_v<OTHER*, Pixel*>>>
+    BasicImageView8880(
+        const BasicImageView8880<OTHER>& view)
+    :
+        m_buffer{view.getBuffer()},
+        m_width{view.getWidth()},
+        m_height{view.getHeight()},
+        m_stride{view.getStride()},
+        m_orientation{view.getOrientation()}
+    {
+    }
+
+    Pixel* getBuffer() const { return m_buffer; }
+    int16_t getWidth() const { return m_width; }
+    int16_t getHeight() const { return m_height; }
+    int32_t getStride() const { return m_stride; }
+    ImageOrientation getOrientation() const { return m_orientation; }
+
+    bool
+    validPixel(
+        const Image8880Point& p) const
+    {
+        return (p.x() >= 0) and
+               (p.y() >= 0) and
+               (p.x() < m_width) and
+               (p.y() < m_height);
+    }
+
+    bool
+    setPixelRGB(
+        const Image8880Point& p,
+        const RGB8880& rgb) const
+    {
+        return setPixel(p, rgb.get8880());
+    }
+
+    bool
+    setPixel(
+        const Image8880Point& p,
+        uint32_t rgb) const
+    {
+        const bool isValid{validPixel(p)};
+
+        if (isValid)
+        {
+            m_buffer[offset(p)] = rgb;
+        }
+
+        return isValid;
+    }
+
+    std::pair<bool, RGB8880>
+    getPixelRGB(
+        const Image8880Point& p) const
+    {
+        const auto [isValid, rgb] = getPixel(p);
+        return std::make_pair(isValid, RGB8880{rgb});
+    }
+
+    std::pair<bool, uint32_t>
+    getPixel(
+        const Image8880Point& p) const
+    {
+        const bool isValid{validPixel(p)};
+        return std::make_pair(isValid, (isValid) ? m_buffer[offset(p)] : 0);
+    }
+
+    // As Image8880::getColumn(), the line at index x, which in COLUMNS is
+    // the column x from the right. Returns nullptr if there isn't one.
+
+    Pixel*
+    getColumn(
+        int16_t x) const
+    {
+        const int16_t lines = (m_orientation == ImageOrientation::COLUMNS)
+                            ? m_width
+                            : m_height;
+
+        return ((x >= 0) and (x < lines)) ? m_buffer + (x * m_stride) : nullptr;
+    }
+
+    void
+    clear(
+        uint32_t rgb) const
+    {
+        const bool columns = (m_orientation == ImageOrientation::COLUMNS);
+        const int16_t lines = (columns) ? m_width : m_height;
+        const int16_t length = (columns) ? m_height : m_width;
+
+        for (int16_t i = 0 ; i < lines ; ++i)
+        {
+            std::fill_n(m_buffer + (i * m_stride), length, rgb);
+        }
+    }
+
+    void clear(const RGB8880& rgb) const { clear(rgb.get8880()); }
+
+    // A view of the part of this one at p, clipped to it.
+
+    BasicImageView8880
+    subView(
+        const Image8880Point& p,
+        int16_t width,
+        int16_t height) const
+    {
+        const int16_t x1 = std::clamp<int16_t>(p.x(), 0, m_width);
+        const int16_t y1 = std::clamp<int16_t>(p.y(), 0, m_height);
+        const int16_t x2 = std::clamp<int16_t>(p.x() + width, x1, m_width);
+        const int16_t y2 = std::clamp<int16_t>(p.y() + height, y1, m_height);
+
+        // The lines of a view in COLUMNS start from its right hand side.
+
+        const size_t start = (m_orientation == ImageOrientation::COLUMNS)
+                           ? y1 + ((m_width - x2) * m_stride)
+                           : x1 + (y1 * m_stride);
+
+        return BasicImageView8880(m_buffer + start,
+                                  x2 - x1,
+                                  y2 - y1,
+                                  m_stride,
+                                  m_orientation);
+    }
+
+private:
+
+    size_t
+    offset(
+        const Image8880Point& p) const
+    {
+        if (m_orientation == ImageOrientation::COLUMNS)
+        {
+            return p.y() + ((m_width - 1 - p.x()) * m_stride);
+        }
+
+        return p.x() + (p.y() * m_stride);
+    }
+
+    Pixel* m_buffer{nullptr};
+    int16_t m_width{0};
+    int16_t m_height{0};
+    int32_t m_stride{0};
+    ImageOrientation m_orientation{ImageOrientation::COLUMNS};
+};
+
+//-------------------------------------------------------------------------
+
+using ImageView8880 = BasicImageView8880<uint32_t>;
+using ConstImageView8880 = BasicImageView8880<const uint32_t>;
+
+//-------------------------------------------------------------------------
+
+} // namespace ogsfb32
+
@@ -25,42 +25,153 @@
 //
 //-------------------------------------------------------------------------
 
+
+#include <dirent.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/inotify.h>
 #include <sys/ioctl.h>
-#include <sys/stat.h>
-#include <sys/types.h>
 
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <ctime>
 #include <system_error>
 
 #include "joystick.h"
 
 //-------------------------------------------------------------------------
 
+namespace
+{
+
+//-------------------------------------------------------------------------
+
+const std::string inputDirectory = "/dev/input";
+
+constexpr int bitsPerLong = sizeof(unsigned long) * CHAR_BIT;
+
+template<int BITS>
+using BitSet = std::array<unsigned long, (BITS + bitsPerLong - 1) / bitsPerLong>;
+
+//-------------------------------------------------------------------------
+
+template<int BITS>
+bool
+testBit(
+    const BitSet<BITS>& bits,
+    int bit)
+{
+    return (bits[bit / bitsPerLong] >> (bit % bitsPerLong)) & 1;
+}
+
+//-------------------------------------------------------------------------
+
+template<int BITS>
+bool
+anyBit(
+    const BitSet<BITS>& bits,
+    int first,
+    int last)
+{
+    for (int bit = first ; bit <= last ; ++bit)
+    {
+        if (testBit<BITS>(bits, bit))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//-------------------------------------------------------------------------
+
+std::chrono::steady_clock::time_point
+eventTime(
+    const struct input_event& event)
+{
+    using namespace std::chrono;
+
+    return steady_clock::time_point{seconds{event.input_event_sec} +
+                                    microseconds{event.input_event_usec}};
+}
+
+//-------------------------------------------------------------------------
+
+} // namespace
+
+//-------------------------------------------------------------------------
+
 ogsfb32::Joystick:: Joystick(bool blocking)
 :
-    m_joystickFd{::open("/dev/input/js0", O_RDONLY | ((blocking) ? 0 : O_NONBLOCK))},
+    m_epollFd{::epoll_create1(EPOLL_CLOEXEC)},
+    m_inotifyFd{::inotify_init1(IN_NONBLOCK | IN_CLOEXEC)},
     m_blocking(blocking),
-    m_buttonCount(0),
+    m_mapping{JoystickMapping::load()},
     m_joystickCount(0),
+    m_devices(),
     m_buttons(),
-    m_joysticks()
+    m_joysticks(),
+    m_lastEventTime()
 {
     init();
+
+    if (m_inotifyFd.fd() == -1)
+    {
+        throw std::system_error{errno,
+                                std::system_category(),
+                                "cannot create inotify instance"};
+    }
+
+    if (::inotify_add_watch(m_inotifyFd.fd(),
+                            inputDirectory.c_str(),
+                            IN_CREATE | IN_ATTRIB | IN_DELETE) == -1)
+    {
+        throw std::system_error{errno,
+                                std::system_category(),
+                                "cannot watch " + inputDirectory};
+    }
+
+    struct epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.fd = m_inotifyFd.fd();
+
+    if (::epoll_ctl(m_epollFd.fd(), EPOLL_CTL_ADD, m_inotifyFd.fd(), &event) == -1)
+    {
+        throw std::system_error{errno,
+                                std::system_category(),
+                                "cannot add inotify to epoll"};
+    }
+
+    scanDevices();
+
+    if (m_devices.empty())
+    {
+        throw std::system_error{ENODEV,
+                                std::system_category(),
+                                "cannot find joystick device"};
+    }
 }
 
 //-------------------------------------------------------------------------
 
 ogsfb32::Joystick:: Joystick(const std::string& device, bool blocking)
 :
-    m_joystickFd{::open(device.c_str(), O_RDONLY | ((blocking) ? 0 : O_NONBLOCK))},
+    m_epollFd{::epoll_create1(EPOLL_CLOEXEC)},
+    m_inotifyFd{-1},
     m_blocking(blocking),
-    m_buttonCount(0),
+    m_mapping{JoystickMapping::load()},
     m_joystickCount(0),
+    m_devices(),
     m_buttons(),
-    m_joysticks()
+    m_joysticks(),
+    m_lastEventTime()
 {
     init();
+    openDevice(device, true);
 }
 
 //-------------------------------------------------------------------------
@@ -68,33 +179,201 @@ ogsfb32::Joystick:: Joystick(const std::string& device, bool blocking)
 void
 ogsfb32::Joystick:: init()
 {
-    if (m_joystickFd.fd() == -1)
+    if (m_epollFd.fd() == -1)
     {
         throw std::system_error{errno,
-                                std::system_category(), 
-                                "cannot open joystick device"};
+                                std::system_category(),
+                                "cannot create epoll instance"};
     }
 
-    char joystickCount = 0;
-    if (ioctl(m_joystickFd.fd(), JSIOCGAXES, &joystickCount) == -1)
+    m_buttons.resize(BUTTON_COUNT, ButtonState{ false, false, {} });
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::Joystick:: scanDevices()
+{
+    DIR* directory = ::opendir(inputDirectory.c_str());
+
+    if (directory == nullptr)
     {
         throw std::system_error{errno,
-                                std::system_category(), 
-                                "reading number of axes"};
+                                std::system_category(),
+                                "cannot open " + inputDirectory};
     }
-    m_joystickCount = joystickCount / 2;
 
-    char buttonCount = 0;
-    if (ioctl(m_joystickFd.fd(), JSIOCGBUTTONS, &buttonCount) == -1)
+    std::vector<std::string> paths;
+
+    while (struct dirent* entry = ::readdir(directory))
+    {
+        const std::string name = entry->d_name;
+
+        if (name.compare(0, 5, "event") == 0)
+        {
+            paths.push_back(inputDirectory + "/" + name);
+        }
+    }
+
+    ::closedir(directory);
+
+    std::sort(paths.begin(), paths.end());
+
+    for (const auto& path : paths)
+    {
+        openDevice(path, false);
+    }
+}
+
+//-------------------------------------------------------------------------
+
+bool
+ogsfb32::Joystick:: openDevice(
+    const std::string& path,
+    bool required)
+{
+    for (const auto& device : m_devices)
+    {
+        if (device->path == path)
+        {
+            return true;
+        }
+    }
+
+    FileDescriptor fd{::open(path.c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC)};
+
+    if (fd.fd() == -1)
+    {
+        if (required)
+        {
+            throw std::system_error{errno,
+                                    std::system_category(),
+                                    "cannot open joystick device " + path};
+        }
+
+        return false;
+    }
+
+    BitSet<KEY_CNT> keyBits{};
+
+    if (::ioctl(fd.fd(), EVIOCGBIT(EV_KEY, sizeof(keyBits)), keyBits.data()) == -1)
+    {
+        if (required)
+        {
+            throw std::system_error{errno,
+                                    std::system_category(),
+                                    path + " is not an input event device"};
+        }
+
+        return false;
+    }
+
+    // The same test as the kernel uses for the legacy joystick interface,
+    // widened to take in pads that only have d-pad and trigger buttons.
+
+    const bool joystick = anyBit<KEY_CNT>(keyBits, BTN_JOYSTICK, BTN_DIGI - 1) or
+                          anyBit<KEY_CNT>(keyBits, BTN_DPAD_UP, BTN_DPAD_RIGHT) or
+                          anyBit<KEY_CNT>(keyBits, BTN_TRIGGER_HAPPY, BTN_TRIGGER_HAPPY40);
+
+    if (not joystick and not required)
+    {
+        return false;
+    }
+
+    // Timestamp events on the same clock as std::chrono::steady_clock.
+    // Kernels too old to change the clock leave it as CLOCK_REALTIME.
+
+    int clock = CLOCK_MONOTONIC;
+    ::ioctl(fd.fd(), EVIOCSCLOCKID, &clock);
+
+    auto device = std::make_unique<Device>(Device{ path, std::move(fd), {}, {}, {}, false });
+
+    // Legacy button numbers are given to the buttons from BTN_MISC up,
+    // then to the keys below BTN_MISC.
+
+    device->buttons.fill(-1);
+    int index = 0;
+
+    for (int code = BTN_MISC ; code < KEY_CNT ; ++code)
+    {
+        if (testBit<KEY_CNT>(keyBits, code))
+        {
+            device->buttons[code] = m_mapping.button(code, index++);
+        }
+    }
+
+    for (int code = 0 ; code < BTN_MISC ; ++code)
+    {
+        if (testBit<KEY_CNT>(keyBits, code))
+        {
+            device->buttons[code] = m_mapping.button(code, index++);
+        }
+    }
+
+    BitSet<ABS_CNT> absBits{};
+    device->axes.fill(-1);
+
+    if (::ioctl(device->fd.fd(), EVIOCGBIT(EV_ABS, sizeof(absBits)), absBits.data()) != -1)
+    {
+        int axis = 0;
+
+        for (int code = 0 ; code < ABS_CNT ; ++code)
+        {
+            if (testBit<ABS_CNT>(absBits, code))
+            {
+                device->axes[code] = axis++;
+            }
+        }
+
+        m_joystickCount = std::max(m_joystickCount, axis / 2);
+        m_joysticks.resize(m_joystickCount, JoystickAxes{ 0, 0 });
+    }
+
+    struct epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.fd = device->fd.fd();
+
+    if (::epoll_ctl(m_epollFd.fd(), EPOLL_CTL_ADD, device->fd.fd(), &event) == -1)
     {
         throw std::system_error{errno,
-                                std::system_category(), 
-                                "reading number of buttons"};
+                                std::system_category(),
+                                "cannot add joystick device to epoll"};
+    }
+
+    sync(*device);
+    m_devices.push_back(std::move(device));
+
+    return true;
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::Joystick:: closeDevice(
+    size_t index)
+{
+    auto& device = *m_devices[index];
+    const auto now = std::chrono::steady_clock::now();
+
+    ::epoll_ctl(m_epollFd.fd(), EPOLL_CTL_DEL, device.fd.fd(), nullptr);
+
+    for (const auto button : device.buttons)
+    {
+        if ((button != -1) and m_buttons[button].down)
+        {
+            setButton(button, false, now);
+        }
+    }
+
+    for (const auto axis : device.axes)
+    {
+        if ((axis != -1) and (axis / 2 < m_joystickCount))
+        {
+            m_joysticks[axis / 2] = JoystickAxes{ 0, 0 };
+        }
     }
-    m_buttonCount = buttonCount;
 
-    m_buttons.resize(m_buttonCount, ButtonState{ false, false });
-    m_joysticks.resize(m_joystickCount, JoystickAxes{ 0, 0 });
+    m_devices.erase(m_devices.begin() + index);
 }
 
 //-------------------------------------------------------------------------
@@ -102,7 +381,7 @@ ogsfb32::Joystick:: init()
 int
 ogsfb32::Joystick:: numberOfButtons() const
 {
-    return m_buttonCount;
+    return BUTTON_COUNT;
 }
 
 //-------------------------------------------------------------------------
@@ -146,24 +425,41 @@ ogsfb32::Joystick:: getAxes(int joystickNumber) const
 
 //-------------------------------------------------------------------------
 
+std::chrono::steady_clock::time_point
+ogsfb32::Joystick:: buttonTime(int button) const
+{
+    return m_buttons.at(button).time;
+}
+
+//-------------------------------------------------------------------------
+
+std::chrono::steady_clock::time_point
+ogsfb32::Joystick:: lastEventTime() const
+{
+    return m_lastEventTime;
+}
+
+//-------------------------------------------------------------------------
+
 void
 ogsfb32::Joystick:: read()
 {
-    struct js_event event;
-    ssize_t bytes = 0;
-
     if (m_blocking)
     {
-        if ((bytes = ::read(m_joystickFd.fd(), &event, sizeof(event))) != -1)
-        {
-            process(event);
-        }
+        struct epoll_event event;
+        ::epoll_wait(m_epollFd.fd(), &event, 1, -1);
     }
-    else
+
+    if (m_inotifyFd.fd() != -1)
     {
-        while ((bytes = ::read(m_joystickFd.fd(), &event, sizeof(event))) != -1)
+        readHotplug();
+    }
+
+    for (size_t index = m_devices.size() ; index > 0 ; --index)
+    {
+        if (not readDevice(*m_devices[index - 1]))
         {
-            process(event);
+            closeDevice(index - 1);
         }
     }
 }
@@ -171,45 +467,224 @@ ogsfb32::Joystick:: read()
 //-------------------------------------------------------------------------
 
 void
- ogsfb32::Joystick:: process(const struct js_event& event)
+ogsfb32::Joystick:: readHotplug()
 {
-    switch (event.type)
+    alignas(struct inotify_event) char buffer[4096];
+    ssize_t bytes = 0;
+
+    while ((bytes = ::read(m_inotifyFd.fd(), buffer, sizeof(buffer))) > 0)
     {
-        case JS_EVENT_BUTTON:
+        for (char* next = buffer ; next < buffer + bytes ; )
+        {
+            const auto event = reinterpret_cast<const struct inotify_event*>(next);
+            next += sizeof(struct inotify_event) + event->len;
+
+            if ((event->len == 0) or (std::string(event->name).compare(0, 5, "event") != 0))
+            {
+                continue;
+            }
+
+            const auto path = inputDirectory + "/" + event->name;
 
-            if (event.value)
+            if (event->mask & IN_DELETE)
             {
-                m_buttons.at(event.number) = ButtonState{ true, true };
+                for (size_t index = 0 ; index < m_devices.size() ; ++index)
+                {
+                    if (m_devices[index]->path == path)
+                    {
+                        closeDevice(index);
+                        break;
+                    }
+                }
             }
             else
             {
-                m_buttons.at(event.number).down = false;
+                // A new node may not be readable until udev has set its
+                // permissions, which is seen as IN_ATTRIB.
+
+                openDevice(path, false);
             }
+        }
+    }
+}
 
-            break;
+//-------------------------------------------------------------------------
+
+bool
+ogsfb32::Joystick:: readDevice(
+    Device& device)
+{
+    std::array<struct input_event, 64> events;
+    ssize_t bytes = 0;
+
+    while ((bytes = ::read(device.fd.fd(), events.data(), sizeof(events))) > 0)
+    {
+        const size_t count = bytes / sizeof(struct input_event);
 
-        case JS_EVENT_AXIS:
+        for (size_t i = 0 ; i < count ; ++i)
         {
-            size_t axis = event.number / 2;
+            const auto& event = events[i];
+            const auto time = eventTime(event);
+
+            m_lastEventTime = time;
 
-            if (axis < 3)
+            if (device.dropped)
             {
-                auto axes = m_joysticks.at(axis);
+                // Events were lost, so the rest of this report is
+                // incomplete. Read the state afresh at its end.
 
-                if (event.number % 2 == 0)
+                if ((event.type == EV_SYN) and (event.code == SYN_REPORT))
                 {
-                    axes.x = event.value;
+                    device.dropped = false;
+                    sync(device);
                 }
-                else
+
+                continue;
+            }
+
+            switch (event.type)
+            {
+                case EV_KEY:
                 {
-                    axes.y = event.value;
+                    const int button = device.buttons[event.code];
+
+                    // A value of 2 is auto repeat.
+
+                    if ((button != -1) and (event.value != 2))
+                    {
+                        setButton(button, event.value, time);
+                    }
+
+                    break;
                 }
+                case EV_ABS:
+
+                    device.absInfo[event.code].value = event.value;
+                    setAxis(device, event.code, event.value);
 
-                m_joysticks[axis] = axes;
+                    break;
+
+                case EV_SYN:
+
+                    if (event.code == SYN_DROPPED)
+                    {
+                        device.dropped = true;
+                    }
+
+                    break;
+            }
+        }
+    }
+
+    return not ((bytes == -1) and (errno == ENODEV));
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::Joystick:: sync(
+    Device& device)
+{
+    const auto now = std::chrono::steady_clock::now();
+
+    BitSet<KEY_CNT> keyBits{};
+
+    if (::ioctl(device.fd.fd(), EVIOCGKEY(sizeof(keyBits)), keyBits.data()) != -1)
+    {
+        for (int code = 0 ; code < KEY_CNT ; ++code)
+        {
+            const int button = device.buttons[code];
+            const bool down = testBit<KEY_CNT>(keyBits, code);
+
+            if ((button != -1) and (m_buttons[button].down != down))
+            {
+                setButton(button, down, now);
             }
+        }
+    }
+
+    for (int code = 0 ; code < ABS_CNT ; ++code)
+    {
+        if ((device.axes[code] != -1) and
+            (::ioctl(device.fd.fd(), EVIOCGABS(code), &device.absInfo[code]) != -1))
+        {
+            setAxis(device, code, device.absInfo[code].value);
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::Joystick:: setButton(
+    int button,
+    bool down,
+    std::chrono::steady_clock::time_point time)
+{
+    auto& state = m_buttons[button];
 
-            break;
+    if (down)
+    {
+        state = ButtonState{ true, true, time };
+    }
+    else
+    {
+        state.down = false;
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::Joystick:: setAxis(
+    const Device& device,
+    int code,
+    int value)
+{
+    const int axis = device.axes[code];
+
+    if ((axis == -1) or (axis / 2 >= m_joystickCount))
+    {
+        return;
+    }
+
+    // Scale to the range of the legacy interface, with the flat region
+    // around the centre reading as zero.
+
+    const auto& info = device.absInfo[code];
+    const int64_t range = static_cast<int64_t>(info.maximum) - info.minimum;
+    int32_t scaled = 0;
+
+    if (range > 0)
+    {
+        const int64_t half = std::max<int64_t>((range / 2) - info.flat, 1);
+        int64_t offset = value - (info.minimum + (range / 2));
+
+        if (offset > info.flat)
+        {
+            offset -= info.flat;
+        }
+        else if (offset < -info.flat)
+        {
+            offset += info.flat;
+        }
+        else
+        {
+            offset = 0;
         }
+
+        scaled = std::clamp<int64_t>((offset * 32767) / half, -32767, 32767);
+    }
+
+    auto& axes = m_joysticks[axis / 2];
+
+    if (axis % 2 == 0)
+    {
+        axes.x = scaled;
+    }
+    else
+    {
+        axes.y = scaled;
     }
 }
 
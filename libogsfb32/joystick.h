@@ -29,14 +29,17 @@
 
 //-------------------------------------------------------------------------
 
-#include <linux/joystick.h>
+#include <linux/input.h>
 
+#include <array>
+#include <chrono>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "fileDescriptor.h"
-#include "linuxRelease.h"
+#include "joystickMapping.h"
 
 //-------------------------------------------------------------------------
 
@@ -57,15 +60,26 @@ struct ButtonState
 {
     bool pressed;
     bool down;
+    std::chrono::steady_clock::time_point time;
 };
 
 //-------------------------------------------------------------------------
 
+// Reads the buttons and sticks from evdev devices. Key codes are mapped to
+// the logical buttons by a JoystickMapping. Axes are numbered, and scaled
+// to -32767 to 32767, as the legacy joystick interface would, and are
+// paired into sticks.
+//
+// Event times are the kernel timestamps on CLOCK_MONOTONIC, which is the
+// clock of std::chrono::steady_clock.
+//
+// The default constructor opens every joystick like device in /dev/input
+// and watches the directory, so devices can come and go.
+
 class Joystick
 {
 public:
 
-#if defined(DEBIAN)
     enum Buttons
     {
         BUTTON_B = 0,
@@ -85,31 +99,9 @@ public:
         BUTTON_BOTTOM_RIGHT_INNER = 14,
         BUTTON_BOTTOM_RIGHT_OUTER = 15,
         BUTTON_LEFT_SHOULDER_INNER = 16,
-        BUTTON_RIGHT_SHOULDER_INNER = 17
-    };
-#elif  defined(UBUNTU) 
-    enum Buttons
-    {
-        BUTTON_B = 0,
-        BUTTON_A = 1,
-        BUTTON_X = 2,
-        BUTTON_Y = 3,
-        BUTTON_LEFT_SHOULDER_OUTER = 4,
-        BUTTON_RIGHT_SHOULDER_OUTER = 5,
-        BUTTON_LEFT_SHOULDER_INNER = 6,
-        BUTTON_RIGHT_SHOULDER_INNER = 7,
-        BUTTON_DPAD_UP = 8,
-        BUTTON_DPAD_DOWN = 9,
-        BUTTON_DPAD_LEFT = 10,
-        BUTTON_DPAD_RIGHT = 11,
-        BUTTON_TOP_LEFT = 12,
-        BUTTON_TOP_RIGHT = 13,
-        BUTTON_BOTTOM_LEFT_OUTER = 14,
-        BUTTON_BOTTOM_LEFT_INNER = 15,
-        BUTTON_BOTTOM_RIGHT_INNER = 16,
-        BUTTON_BOTTOM_RIGHT_OUTER = 17
+        BUTTON_RIGHT_SHOULDER_INNER = 17,
+        BUTTON_COUNT = 18
     };
-#endif
 
     explicit Joystick(bool blocking = false);
     Joystick(const std::string& device, bool blocking = false);
@@ -121,22 +113,53 @@ public:
     bool buttonDown(int button) const;
     JoystickAxes getAxes(int joystickNumber) const;
 
+    // The time the button was last pressed, and the time of the most
+    // recent event from any device.
+
+    std::chrono::steady_clock::time_point buttonTime(int button) const;
+    std::chrono::steady_clock::time_point lastEventTime() const;
+
+    // Readable when any device has input or a device is added or
+    // removed. read() still has to be called when it is readable.
+
+    int fd() const { return m_epollFd.fd(); }
+
     void read();
 
 private:
 
-    void init();
-    void process(const struct js_event& event);
+    struct Device
+    {
+        std::string path;
+        FileDescriptor fd;
+        std::array<int8_t, KEY_CNT> buttons;
+        std::array<int8_t, ABS_CNT> axes;
+        std::array<struct input_absinfo, ABS_CNT> absInfo;
+        bool dropped;
+    };
 
-    FileDescriptor m_joystickFd;
+    void init();
+    void scanDevices();
+    bool openDevice(const std::string& path, bool required);
+    void closeDevice(size_t index);
+    void readHotplug();
+    bool readDevice(Device& device);
+    void sync(Device& device);
+    void setButton(int button, bool down, std::chrono::steady_clock::time_point time);
+    void setAxis(const Device& device, int code, int value);
+
+    FileDescriptor m_epollFd;
+    FileDescriptor m_inotifyFd;
 
     bool m_blocking;
+    JoystickMapping m_mapping;
 
-    int m_buttonCount;
     int m_joystickCount;
 
+    std::vector<std::unique_ptr<Device>> m_devices;
     std::vector<ButtonState> m_buttons;
     std::vector<JoystickAxes> m_joysticks;
+    std::chrono::steady_clock::time_point m_lastEventTime;
 };
 
 //-------------------------------------------------------------------------
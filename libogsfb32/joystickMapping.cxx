@@ -0,0 +1,344 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <linux/input.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdlib>
+#include <fstream>
+#include <stdexcept>
+#include <system_error>
+
+#include "joystick.h"
+#include "joystickMapping.h"
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+
+//-------------------------------------------------------------------------
+
+using ogsfb32::Joystick;
+
+//-------------------------------------------------------------------------
+
+// Legacy button numbers on the Debian image, which are the order of the
+// logical buttons.
+
+const std::vector<int> debianButtons
+{
+    Joystick::BUTTON_B,
+    Joystick::BUTTON_A,
+    Joystick::BUTTON_X,
+    Joystick::BUTTON_Y,
+    Joystick::BUTTON_LEFT_SHOULDER_OUTER,
+    Joystick::BUTTON_RIGHT_SHOULDER_OUTER,
+    Joystick::BUTTON_DPAD_UP,
+    Joystick::BUTTON_DPAD_DOWN,
+    Joystick::BUTTON_DPAD_LEFT,
+    Joystick::BUTTON_DPAD_RIGHT,
+    Joystick::BUTTON_BOTTOM_LEFT_OUTER,
+    Joystick::BUTTON_BOTTOM_LEFT_INNER,
+    Joystick::BUTTON_TOP_LEFT,
+    Joystick::BUTTON_TOP_RIGHT,
+    Joystick::BUTTON_BOTTOM_RIGHT_INNER,
+    Joystick::BUTTON_BOTTOM_RIGHT_OUTER,
+    Joystick::BUTTON_LEFT_SHOULDER_INNER,
+    Joystick::BUTTON_RIGHT_SHOULDER_INNER
+};
+
+// Legacy button numbers on the Ubuntu image.
+
+const std::vector<int> ubuntuButtons
+{
+    Joystick::BUTTON_B,
+    Joystick::BUTTON_A,
+    Joystick::BUTTON_X,
+    Joystick::BUTTON_Y,
+    Joystick::BUTTON_LEFT_SHOULDER_OUTER,
+    Joystick::BUTTON_RIGHT_SHOULDER_OUTER,
+    Joystick::BUTTON_LEFT_SHOULDER_INNER,
+    Joystick::BUTTON_RIGHT_SHOULDER_INNER,
+    Joystick::BUTTON_DPAD_UP,
+    Joystick::BUTTON_DPAD_DOWN,
+    Joystick::BUTTON_DPAD_LEFT,
+    Joystick::BUTTON_DPAD_RIGHT,
+    Joystick::BUTTON_TOP_LEFT,
+    Joystick::BUTTON_TOP_RIGHT,
+    Joystick::BUTTON_BOTTOM_LEFT_OUTER,
+    Joystick::BUTTON_BOTTOM_LEFT_INNER,
+    Joystick::BUTTON_BOTTOM_RIGHT_INNER,
+    Joystick::BUTTON_BOTTOM_RIGHT_OUTER
+};
+
+//-------------------------------------------------------------------------
+
+const std::map<std::string, int> buttonNames
+{
+    { "BUTTON_A", Joystick::BUTTON_A },
+    { "BUTTON_B", Joystick::BUTTON_B },
+    { "BUTTON_X", Joystick::BUTTON_X },
+    { "BUTTON_Y", Joystick::BUTTON_Y },
+    { "BUTTON_LEFT_SHOULDER_OUTER", Joystick::BUTTON_LEFT_SHOULDER_OUTER },
+    { "BUTTON_RIGHT_SHOULDER_OUTER", Joystick::BUTTON_RIGHT_SHOULDER_OUTER },
+    { "BUTTON_LEFT_SHOULDER_INNER", Joystick::BUTTON_LEFT_SHOULDER_INNER },
+    { "BUTTON_RIGHT_SHOULDER_INNER", Joystick::BUTTON_RIGHT_SHOULDER_INNER },
+    { "BUTTON_DPAD_UP", Joystick::BUTTON_DPAD_UP },
+    { "BUTTON_DPAD_DOWN", Joystick::BUTTON_DPAD_DOWN },
+    { "BUTTON_DPAD_LEFT", Joystick::BUTTON_DPAD_LEFT },
+    { "BUTTON_DPAD_RIGHT", Joystick::BUTTON_DPAD_RIGHT },
+    { "BUTTON_TOP_LEFT", Joystick::BUTTON_TOP_LEFT },
+    { "BUTTON_TOP_RIGHT", Joystick::BUTTON_TOP_RIGHT },
+    { "BUTTON_BOTTOM_LEFT_OUTER", Joystick::BUTTON_BOTTOM_LEFT_OUTER },
+    { "BUTTON_BOTTOM_LEFT_INNER", Joystick::BUTTON_BOTTOM_LEFT_INNER },
+    { "BUTTON_BOTTOM_RIGHT_INNER", Joystick::BUTTON_BOTTOM_RIGHT_INNER },
+    { "BUTTON_BOTTOM_RIGHT_OUTER", Joystick::BUTTON_BOTTOM_RIGHT_OUTER }
+};
+
+//-------------------------------------------------------------------------
+
+const std::map<std::string, int> keyNames
+{
+    { "BTN_SOUTH", BTN_SOUTH },
+    { "BTN_EAST", BTN_EAST },
+    { "BTN_C", BTN_C },
+    { "BTN_NORTH", BTN_NORTH },
+    { "BTN_WEST", BTN_WEST },
+    { "BTN_Z", BTN_Z },
+    { "BTN_A", BTN_A },
+    { "BTN_B", BTN_B },
+    { "BTN_X", BTN_X },
+    { "BTN_Y", BTN_Y },
+    { "BTN_TL", BTN_TL },
+    { "BTN_TR", BTN_TR },
+    { "BTN_TL2", BTN_TL2 },
+    { "BTN_TR2", BTN_TR2 },
+    { "BTN_SELECT", BTN_SELECT },
+    { "BTN_START", BTN_START },
+    { "BTN_MODE", BTN_MODE },
+    { "BTN_THUMBL", BTN_THUMBL },
+    { "BTN_THUMBR", BTN_THUMBR },
+    { "BTN_DPAD_UP", BTN_DPAD_UP },
+    { "BTN_DPAD_DOWN", BTN_DPAD_DOWN },
+    { "BTN_DPAD_LEFT", BTN_DPAD_LEFT },
+    { "BTN_DPAD_RIGHT", BTN_DPAD_RIGHT },
+    { "BTN_TRIGGER_HAPPY1", BTN_TRIGGER_HAPPY1 },
+    { "BTN_TRIGGER_HAPPY2", BTN_TRIGGER_HAPPY2 },
+    { "BTN_TRIGGER_HAPPY3", BTN_TRIGGER_HAPPY3 },
+    { "BTN_TRIGGER_HAPPY4", BTN_TRIGGER_HAPPY4 },
+    { "BTN_TRIGGER_HAPPY5", BTN_TRIGGER_HAPPY5 },
+    { "BTN_TRIGGER_HAPPY6", BTN_TRIGGER_HAPPY6 },
+    { "BTN_TRIGGER_HAPPY7", BTN_TRIGGER_HAPPY7 },
+    { "BTN_TRIGGER_HAPPY8", BTN_TRIGGER_HAPPY8 },
+    { "KEY_VOLUMEUP", KEY_VOLUMEUP },
+    { "KEY_VOLUMEDOWN", KEY_VOLUMEDOWN },
+    { "KEY_POWER", KEY_POWER }
+};
+
+//-------------------------------------------------------------------------
+
+std::string
+trim(
+    const std::string& text)
+{
+    const auto first = text.find_first_not_of(" \t\r");
+
+    if (first == std::string::npos)
+    {
+        return "";
+    }
+
+    const auto last = text.find_last_not_of(" \t\r");
+
+    return text.substr(first, last - first + 1);
+}
+
+//-------------------------------------------------------------------------
+
+std::string
+releaseId()
+{
+    std::ifstream ifs{"/etc/os-release"};
+    std::string line;
+
+    while (std::getline(ifs, line))
+    {
+        if (line.compare(0, 3, "ID=") == 0)
+        {
+            std::string id = line.substr(3);
+
+            if ((id.size() >= 2) and (id.front() == '"') and (id.back() == '"'))
+            {
+                id = id.substr(1, id.size() - 2);
+            }
+
+            return id;
+        }
+    }
+
+    return "";
+}
+
+//-------------------------------------------------------------------------
+
+} // namespace
+
+//-------------------------------------------------------------------------
+
+ogsfb32::JoystickMapping:: JoystickMapping()
+:
+    m_byIndex{(releaseId() == "ubuntu") ? ubuntuButtons : debianButtons},
+    m_byCode()
+{
+}
+
+//-------------------------------------------------------------------------
+
+ogsfb32::JoystickMapping:: JoystickMapping(const std::string& filename)
+:
+    m_byIndex(),
+    m_byCode()
+{
+    std::ifstream ifs{filename};
+
+    if (not ifs)
+    {
+        throw std::system_error{errno,
+                                std::system_category(),
+                                "cannot open " + filename};
+    }
+
+    std::string line;
+    int lineNumber = 0;
+
+    while (std::getline(ifs, line))
+    {
+        ++lineNumber;
+        line = trim(line);
+
+        if (line.empty() or (line[0] == '#'))
+        {
+            continue;
+        }
+
+        const auto where = filename + ":" + std::to_string(lineNumber);
+        const auto equals = line.find('=');
+
+        if (equals == std::string::npos)
+        {
+            throw std::runtime_error(where + ": expected BUTTON = KEY");
+        }
+
+        const auto buttonName = trim(line.substr(0, equals));
+        const auto keyName = trim(line.substr(equals + 1));
+
+        const auto button = buttonNames.find(buttonName);
+
+        if (button == buttonNames.end())
+        {
+            throw std::runtime_error(where + ": unknown button " + buttonName);
+        }
+
+        int code = -1;
+        const auto key = keyNames.find(keyName);
+
+        if (key != keyNames.end())
+        {
+            code = key->second;
+        }
+        else
+        {
+            char* end = nullptr;
+            const long value = std::strtol(keyName.c_str(), &end, 0);
+
+            if (not keyName.empty() and (*end == '\0') and (value >= 0) and (value <= KEY_MAX))
+            {
+                code = value;
+            }
+        }
+
+        if (code == -1)
+        {
+            throw std::runtime_error(where + ": unknown key code " + keyName);
+        }
+
+        m_byCode[code] = button->second;
+    }
+}
+
+//-------------------------------------------------------------------------
+
+ogsfb32::JoystickMapping
+ogsfb32::JoystickMapping:: load()
+{
+    std::vector<std::string> filenames;
+
+    const char* home = ::getenv("HOME");
+
+    if (home != nullptr)
+    {
+        filenames.push_back(std::string(home) + "/.ogsfb32/joystick.conf");
+    }
+
+    filenames.push_back("/etc/ogsfb32/joystick.conf");
+
+    for (const auto& filename : filenames)
+    {
+        if (::access(filename.c_str(), R_OK) == 0)
+        {
+            return JoystickMapping{filename};
+        }
+    }
+
+    return JoystickMapping{};
+}
+
+//-------------------------------------------------------------------------
+
+int
+ogsfb32::JoystickMapping:: button(
+    int code,
+    int index) const
+{
+    if (not m_byCode.empty())
+    {
+        const auto button = m_byCode.find(code);
+
+        return (button == m_byCode.end()) ? -1 : button->second;
+    }
+
+    if ((index >= 0) and (index < static_cast<int>(m_byIndex.size())))
+    {
+        return m_byIndex[index];
+    }
+
+    return -1;
+}
+
@@ -0,0 +1,85 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <map>
+#include <string>
+#include <vector>
+
+//-------------------------------------------------------------------------
+
+namespace ogsfb32
+{
+
+//-------------------------------------------------------------------------
+
+// Maps evdev key codes to the logical Joystick::Buttons.
+//
+// The built in mappings are chosen at run time from /etc/os-release, as the
+// Debian and Ubuntu kernels report the Odroid Go Super buttons with
+// different key codes. They are given as the button numbers the legacy
+// joystick interface would use, which are assigned in key code order.
+//
+// A mapping file replaces the built in mapping. Each line names a button
+// and the key code for it, either as a number or by name, e.g.
+//
+//     BUTTON_A = BTN_EAST
+//     BUTTON_DPAD_UP = 544
+//
+// Blank lines and lines starting with '#' are ignored.
+
+class JoystickMapping
+{
+public:
+
+    JoystickMapping();
+    explicit JoystickMapping(const std::string& filename);
+
+    // The mapping from ~/.ogsfb32/joystick.conf or
+    // /etc/ogsfb32/joystick.conf, or the built in one if there is neither.
+
+    static JoystickMapping load();
+
+    // The logical button for a key code whose legacy button number is
+    // index, or -1 if it is not mapped.
+
+    int button(int code, int index) const;
+
+private:
+
+    std::vector<int> m_byIndex;
+    std::map<int, int> m_byCode;
+};
+
+//-------------------------------------------------------------------------
+
+} // namespace ogsfb32
+
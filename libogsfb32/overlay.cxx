@@ -0,0 +1,442 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <xf86drm.h>
+#include <xf86drmMode.h>
+#include <libdrm/drm_fourcc.h>
+
+#include <algorithm>
+
+#include "atomicModeset.h"
+#include "overlay.h"
+#include "planeManager.h"
+
+//-------------------------------------------------------------------------
+
+ogsfb32::Overlay:: Overlay(
+    const FrameBuffer8880& fb,
+    int16_t width,
+    int16_t height)
+:
+    m_fb(fb),
+    m_image{width, height},
+    m_position{0, 0},
+    m_visible{false},
+    m_manager{nullptr},
+    m_planeId{0},
+    m_format{0},
+    m_buffer{},
+    m_under(),
+    m_underPosition{0, 0}
+{
+}
+
+//-------------------------------------------------------------------------
+
+ogsfb32::Overlay:: Overlay(
+    const FrameBuffer8880& fb,
+    int16_t width,
+    int16_t height,
+    PlaneManager& manager,
+    uint32_t planeId,
+    uint32_t format)
+:
+    m_fb(fb),
+    m_image{width, height},
+    m_position{0, 0},
+    m_visible{false},
+    m_manager{&manager},
+    m_planeId{planeId},
+    m_format{format},
+    m_buffer{},
+    m_under(),
+    m_underPosition{0, 0}
+{
+    // The display is rotated, so the buffer is as wide as the image is
+    // high, and each line of it is a column of the image.
+
+    m_buffer = std::make_unique<DumbBuffer>(fb.getFileDescriptor(),
+                                            height,
+                                            width,
+                                            format);
+}
+
+//-------------------------------------------------------------------------
+
+ogsfb32::Overlay:: ~Overlay()
+{
+    hide();
+
+    if (m_manager)
+    {
+        m_manager->release(m_planeId);
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::Overlay:: setPosition(
+    const FB8880Point& position)
+{
+    if (m_visible and not isHardware())
+    {
+        restoreUnder();
+    }
+
+    m_position = position;
+
+    if (m_visible)
+    {
+        if (isHardware() and not placePlane(false))
+        {
+            useSoftware();
+        }
+
+        if (not isHardware())
+        {
+            saveUnder();
+            drawSoftware();
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::Overlay:: show()
+{
+    if (m_visible)
+    {
+        return;
+    }
+
+    m_visible = true;
+
+    if (isHardware())
+    {
+        copyToBuffer();
+
+        if (not placePlane(true))
+        {
+            useSoftware();
+        }
+    }
+
+    if (not isHardware())
+    {
+        saveUnder();
+        drawSoftware();
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::Overlay:: hide()
+{
+    if (not m_visible)
+    {
+        return;
+    }
+
+    m_visible = false;
+
+    if (isHardware())
+    {
+        disablePlane();
+    }
+    else
+    {
+        restoreUnder();
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::Overlay:: update()
+{
+    if (isHardware())
+    {
+        copyToBuffer();
+    }
+    else if (m_visible)
+    {
+        restoreUnder();
+        drawSoftware();
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::Overlay:: copyToBuffer()
+{
+    const auto height = m_image.getHeight();
+    const auto lineLength = m_buffer->getLineLengthPixels();
+
+    for (int16_t i = 0 ; i < m_image.getWidth() ; ++i)
+    {
+        const auto source = m_image.getColumn(i);
+        auto destination = m_buffer->getBuffer() + (i * lineLength);
+
+        if (m_format == DRM_FORMAT_ARGB8888)
+        {
+            std::transform(source, source + height, destination, [](uint32_t rgb)
+            {
+                return (rgb == transparent) ? 0 : (rgb | 0xFF000000);
+            });
+        }
+        else
+        {
+            std::copy(source, source + height, destination);
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+
+bool
+ogsfb32::Overlay:: placePlane(
+    bool test)
+{
+    // Plane coordinates are those of the display, which is rotated from
+    // the screen. Planes may not reach off the display, so clip them.
+
+    const int32_t displayWidth = m_fb.getHeight();
+    const int32_t displayHeight = m_fb.getWidth();
+
+    int32_t x = m_position.y();
+    int32_t y = m_fb.getWidth() - m_position.x() - m_image.getWidth();
+    int32_t width = m_image.getHeight();
+    int32_t height = m_image.getWidth();
+    int32_t sourceX = 0;
+    int32_t sourceY = 0;
+
+    if (x < 0)
+    {
+        sourceX = -x;
+        width += x;
+        x = 0;
+    }
+
+    if (y < 0)
+    {
+        sourceY = -y;
+        height += y;
+        y = 0;
+    }
+
+    width = std::min(width, displayWidth - x);
+    height = std::min(height, displayHeight - y);
+
+    if ((width <= 0) or (height <= 0))
+    {
+        disablePlane();
+        return true;
+    }
+
+    // A scaled frame buffer has the plane scaled with it. Source
+    // coordinates are 16.16 fixed point.
+
+    const auto& mode = m_fb.getMode();
+
+    const int32_t crtcX = (x * mode.width) / displayWidth;
+    const int32_t crtcY = (y * mode.height) / displayHeight;
+    const int32_t crtcWidth = (((x + width) * mode.width) / displayWidth) - crtcX;
+    const int32_t crtcHeight = (((y + height) * mode.height) / displayHeight) - crtcY;
+
+    const AtomicModeset::PlaneState state{ m_fb.getCrtcId(),
+                                           m_buffer->getFbId(),
+                                           crtcX,
+                                           crtcY,
+                                           static_cast<uint32_t>(crtcWidth),
+                                           static_cast<uint32_t>(crtcHeight),
+                                           static_cast<uint32_t>(sourceX) << 16,
+                                           static_cast<uint32_t>(sourceY) << 16,
+                                           static_cast<uint32_t>(width) << 16,
+                                           static_cast<uint32_t>(height) << 16 };
+
+    auto atomic = m_fb.getAtomic();
+
+    if (atomic)
+    {
+        if (test and not atomic->testPlane(m_planeId, state))
+        {
+            return false;
+        }
+
+        atomic->stagePlane(m_planeId, state);
+
+        return true;
+    }
+
+    return drmModeSetPlane(m_fb.getFd(),
+                           m_planeId,
+                           state.crtcId,
+                           state.fbId,
+                           0,
+                           state.x,
+                           state.y,
+                           state.width,
+                           state.height,
+                           state.sourceX,
+                           state.sourceY,
+                           state.sourceWidth,
+                           state.sourceHeight) == 0;
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::Overlay:: disablePlane()
+{
+    auto atomic = m_fb.getAtomic();
+
+    if (atomic)
+    {
+        atomic->stagePlane(m_planeId, AtomicModeset::PlaneState{});
+    }
+    else
+    {
+        drmModeSetPlane(m_fb.getFd(), m_planeId, m_fb.getCrtcId(), 0, 0,
+                        0, 0, 0, 0, 0, 0, 0, 0);
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::Overlay:: useSoftware()
+{
+    disablePlane();
+
+    m_manager->release(m_planeId);
+    m_manager = nullptr;
+    m_buffer.reset();
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::Overlay:: saveUnder()
+{
+    const auto width = m_image.getWidth();
+    const auto height = m_image.getHeight();
+
+    m_under.resize(width * height);
+    m_underPosition = m_position;
+
+    for (int16_t i = 0 ; i < width ; ++i)
+    {
+        const auto column = m_fb.getColumn(m_position.x() + width - 1 - i);
+
+        if (column == nullptr)
+        {
+            continue;
+        }
+
+        for (int16_t j = 0 ; j < height ; ++j)
+        {
+            const int32_t y = m_position.y() + j;
+
+            if ((y >= 0) and (y < m_fb.getHeight()))
+            {
+                m_under[(i * height) + j] = column[y];
+            }
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::Overlay:: restoreUnder()
+{
+    const auto width = m_image.getWidth();
+    const auto height = m_image.getHeight();
+
+    for (int16_t i = 0 ; i < width ; ++i)
+    {
+        auto column = m_fb.getColumn(m_underPosition.x() + width - 1 - i);
+
+        if (column == nullptr)
+        {
+            continue;
+        }
+
+        for (int16_t j = 0 ; j < height ; ++j)
+        {
+            const int32_t y = m_underPosition.y() + j;
+
+            if ((y >= 0) and (y < m_fb.getHeight()))
+            {
+                column[y] = m_under[(i * height) + j];
+            }
+        }
+    }
+
+    m_fb.addDamage(m_underPosition, width, height);
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::Overlay:: drawSoftware()
+{
+    const auto width = m_image.getWidth();
+    const auto height = m_image.getHeight();
+
+    for (int16_t i = 0 ; i < width ; ++i)
+    {
+        auto column = m_fb.getColumn(m_position.x() + width - 1 - i);
+
+        if (column == nullptr)
+        {
+            continue;
+        }
+
+        const auto source = m_image.getColumn(i);
+
+        for (int16_t j = 0 ; j < height ; ++j)
+        {
+            const int32_t y = m_position.y() + j;
+
+            if ((y >= 0) and (y < m_fb.getHeight()) and (source[j] != transparent))
+            {
+                column[y] = source[j];
+            }
+        }
+    }
+
+    // present() only sends damaged areas to the screen.
+
+    m_fb.addDamage(m_position, width, height);
+}
+
@@ -0,0 +1,128 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "dumbBuffer.h"
+#include "framebuffer8880.h"
+#include "image8880.h"
+
+//-------------------------------------------------------------------------
+
+namespace ogsfb32
+{
+
+//-------------------------------------------------------------------------
+
+class PlaneManager;
+
+//-------------------------------------------------------------------------
+
+// An image shown above the frame buffer, such as a HUD or a cursor. Draw
+// into getImage() and call update() to show the changes.
+//
+// On a hardware plane the image is copied to the plane's own buffer, and
+// moving it only changes the plane's position, so nothing under it has to
+// be redrawn. Without a plane it is composited in software: it is drawn
+// into the frame buffer, and what was under it is saved and put back when
+// it moves or is hidden. Anything drawn under a software overlay while it
+// is visible is lost when it moves.
+//
+// With atomic modesetting, changes to a hardware overlay's plane are
+// staged and shown by FrameBuffer8880::present(), along with every other
+// plane change, at the same vertical blank.
+//
+// Pixels of the transparent colour are not shown.
+
+class Overlay
+{
+public:
+
+    static constexpr uint32_t transparent{0xFF000000};
+
+    Overlay(const FrameBuffer8880& fb, int16_t width, int16_t height);
+
+    Overlay(
+        const FrameBuffer8880& fb,
+        int16_t width,
+        int16_t height,
+        PlaneManager& manager,
+        uint32_t planeId,
+        uint32_t format);
+
+    ~Overlay();
+
+    Overlay(const Overlay&) = delete;
+    Overlay& operator=(const Overlay&) = delete;
+
+    Image8880& getImage() { return m_image; }
+    const Image8880& getImage() const { return m_image; }
+
+    bool isHardware() const { return static_cast<bool>(m_buffer); }
+    bool isVisible() const { return m_visible; }
+    const FB8880Point& getPosition() const { return m_position; }
+
+    void setPosition(const FB8880Point& position);
+    void show();
+    void hide();
+    void update();
+
+private:
+
+    void copyToBuffer();
+    bool placePlane(bool test);
+    void disablePlane();
+    void useSoftware();
+    void saveUnder();
+    void restoreUnder();
+    void drawSoftware();
+
+    const FrameBuffer8880& m_fb;
+    Image8880 m_image;
+    FB8880Point m_position;
+    bool m_visible;
+
+    PlaneManager* m_manager;
+    uint32_t m_planeId;
+    uint32_t m_format;
+    std::unique_ptr<DumbBuffer> m_buffer;
+
+    std::vector<uint32_t> m_under;
+    FB8880Point m_underPosition;
+};
+
+//-------------------------------------------------------------------------
+
+} // namespace ogsfb32
+
@@ -0,0 +1,231 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <xf86drm.h>
+#include <xf86drmMode.h>
+#include <libdrm/drm_fourcc.h>
+
+#include <algorithm>
+#include <system_error>
+
+#include "drmUtil.h"
+#include "planeManager.h"
+
+//-------------------------------------------------------------------------
+
+ogsfb32::PlaneManager:: PlaneManager(
+    const FrameBuffer8880& fb)
+:
+    m_fb(fb),
+    m_cursorWidth{64},
+    m_cursorHeight{64},
+    m_planes()
+{
+    const auto& fd = fb.getFileDescriptor();
+
+    // Without universal planes only overlay planes are listed.
+
+    drmSetClientCap(fd.fd(), DRM_CLIENT_CAP_UNIVERSAL_PLANES, 1);
+
+    drmGetCap(fd.fd(), DRM_CAP_CURSOR_WIDTH, &m_cursorWidth);
+    drmGetCap(fd.fd(), DRM_CAP_CURSOR_HEIGHT, &m_cursorHeight);
+
+    auto planeResources = drm::drmModeGetPlaneResources(fd);
+
+    if (not planeResources)
+    {
+        return;
+    }
+
+    for (uint32_t i = 0 ; i < planeResources->count_planes ; ++i)
+    {
+        const uint32_t planeId = planeResources->planes[i];
+        auto plane = drm::drmModeGetPlane(fd, planeId);
+
+        if (not plane or not (plane->possible_crtcs & (1 << fb.getCrtcIndex())))
+        {
+            continue;
+        }
+
+        const uint64_t type = drm::drmGetPropertyValue(fd,
+                                                       planeId,
+                                                       DRM_MODE_OBJECT_PLANE,
+                                                       "type");
+
+        if (type == DRM_PLANE_TYPE_PRIMARY)
+        {
+            continue;
+        }
+
+        // Prefer a format with alpha, so transparent pixels can be shown.
+
+        const auto formats = plane->formats;
+        const auto formatsEnd = plane->formats + plane->count_formats;
+        uint32_t format = 0;
+
+        if (std::find(formats, formatsEnd, DRM_FORMAT_ARGB8888) != formatsEnd)
+        {
+            format = DRM_FORMAT_ARGB8888;
+        }
+        else if (std::find(formats, formatsEnd, DRM_FORMAT_XRGB8888) != formatsEnd)
+        {
+            format = DRM_FORMAT_XRGB8888;
+        }
+        else
+        {
+            continue;
+        }
+
+        m_planes.push_back(Plane{ planeId, type, format, false });
+    }
+}
+
+//-------------------------------------------------------------------------
+
+std::unique_ptr<ogsfb32::Overlay>
+ogsfb32::PlaneManager:: createOverlay(
+    int16_t width,
+    int16_t height,
+    uint8_t zorder,
+    bool cursor)
+{
+    // The display is rotated, so the image is as high on the display as
+    // it is wide on the screen.
+
+    const bool fitsCursor = (height <= static_cast<int64_t>(m_cursorWidth)) and
+                            (width <= static_cast<int64_t>(m_cursorHeight));
+
+    std::vector<uint64_t> types{ DRM_PLANE_TYPE_OVERLAY };
+
+    if (cursor and fitsCursor)
+    {
+        types.insert(types.begin(), DRM_PLANE_TYPE_CURSOR);
+    }
+
+    // Plane buffers are laid out for a rotated display, others get an
+    // overlay in software.
+
+    if (not m_fb.isRotated())
+    {
+        types.clear();
+    }
+
+    for (const auto type : types)
+    {
+        for (auto& plane : m_planes)
+        {
+            if (plane.inUse or (plane.type != type))
+            {
+                continue;
+            }
+
+            try
+            {
+                auto overlay = std::make_unique<Overlay>(m_fb,
+                                                         width,
+                                                         height,
+                                                         *this,
+                                                         plane.id,
+                                                         plane.format);
+                plane.inUse = true;
+                setZorder(plane.id, zorder);
+
+                return overlay;
+            }
+            catch (const std::system_error&)
+            {
+                // No buffer for this plane, so try the next one.
+            }
+        }
+    }
+
+    return std::make_unique<Overlay>(m_fb, width, height);
+}
+
+//-------------------------------------------------------------------------
+
+int
+ogsfb32::PlaneManager:: freePlanes() const
+{
+    return std::count_if(m_planes.begin(),
+                         m_planes.end(),
+                         [](const Plane& plane) { return not plane.inUse; });
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::PlaneManager:: release(
+    uint32_t planeId)
+{
+    for (auto& plane : m_planes)
+    {
+        if (plane.id == planeId)
+        {
+            plane.inUse = false;
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::PlaneManager:: setZorder(
+    uint32_t planeId,
+    uint8_t zorder) const
+{
+    const auto& fd = m_fb.getFileDescriptor();
+    const uint32_t propertyId = drm::drmGetPropertyId(fd,
+                                                      planeId,
+                                                      DRM_MODE_OBJECT_PLANE,
+                                                      "zpos");
+
+    if (propertyId == 0)
+    {
+        return;
+    }
+
+    auto property = drm::drmModeGetProperty(fd, propertyId);
+
+    if (not property or
+        (property->flags & DRM_MODE_PROP_IMMUTABLE) or
+        not (property->flags & DRM_MODE_PROP_RANGE) or
+        (property->count_values < 2))
+    {
+        return;
+    }
+
+    // Keep above the primary plane, which is usually at the bottom of the
+    // range.
+
+    const uint64_t minimum = std::max<uint64_t>(property->values[0], 1);
+    const uint64_t zpos = std::min(minimum + zorder, property->values[1]);
+
+    drmModeObjectSetProperty(fd.fd(), planeId, DRM_MODE_OBJECT_PLANE, propertyId, zpos);
+}
+
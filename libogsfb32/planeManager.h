@@ -0,0 +1,98 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "framebuffer8880.h"
+#include "overlay.h"
+
+//-------------------------------------------------------------------------
+
+namespace ogsfb32
+{
+
+//-------------------------------------------------------------------------
+
+// Finds the overlay and cursor planes that can be shown on the frame
+// buffer's CRTC and hands them out to Overlays. An Overlay gives its plane
+// back when it is destroyed, so it must not outlive the manager.
+
+class PlaneManager
+{
+public:
+
+    explicit PlaneManager(const FrameBuffer8880& fb);
+
+    PlaneManager(const PlaneManager&) = delete;
+    PlaneManager& operator=(const PlaneManager&) = delete;
+
+    // An overlay on a free overlay plane, or on a cursor plane if cursor
+    // is true and the image fits, or composited in software if no plane
+    // is free. Higher zorder overlays are shown above lower ones, where
+    // the driver lets the order of planes be changed.
+
+    std::unique_ptr<Overlay>
+    createOverlay(
+        int16_t width,
+        int16_t height,
+        uint8_t zorder = 0,
+        bool cursor = false);
+
+    int freePlanes() const;
+
+private:
+
+    friend class Overlay;
+
+    struct Plane
+    {
+        uint32_t id;
+        uint64_t type;
+        uint32_t format;
+        bool inUse;
+    };
+
+    void release(uint32_t planeId);
+    void setZorder(uint32_t planeId, uint8_t zorder) const;
+
+    const FrameBuffer8880& m_fb;
+    uint64_t m_cursorWidth;
+    uint64_t m_cursorHeight;
+    std::vector<Plane> m_planes;
+};
+
+//-------------------------------------------------------------------------
+
+} // namespace ogsfb32
+
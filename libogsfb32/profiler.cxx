@@ -0,0 +1,296 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <vector>
+
+#include "profiler.h"
+
+//=========================================================================
+
+namespace
+{
+
+//-------------------------------------------------------------------------
+
+// A slot of the ring buffer, guarded by a sequence lock. The sequence is
+// odd while the recording thread writes event n into the slot, and 2n + 2
+// once it is there. A reader on another thread checks the sequence before
+// and after copying the event, so it never uses one that was overwritten
+// as it read it. The fields are atomic so that the racing read is defined.
+
+struct EventSlot
+{
+    std::atomic<uint64_t> sequence{0};
+    std::atomic<const char*> name{nullptr};
+    std::atomic<uint64_t> start{0};
+    std::atomic<uint64_t> end{0};
+};
+
+//-------------------------------------------------------------------------
+
+struct ThreadEvents
+{
+    explicit ThreadEvents(uint32_t id)
+    :
+        threadId{id},
+        count{0},
+        events(ogsfb32::Profiler::eventsPerThread)
+    {
+    }
+
+    uint32_t threadId;
+    std::atomic<uint64_t> count;
+    std::vector<EventSlot> events;
+};
+
+//-------------------------------------------------------------------------
+
+std::mutex threadsMutex;
+std::vector<std::unique_ptr<ThreadEvents>> threads;
+thread_local ThreadEvents* threadEvents = nullptr;
+
+//-------------------------------------------------------------------------
+
+ThreadEvents*
+registerThread()
+{
+    std::lock_guard<std::mutex> lock(threadsMutex);
+
+    threads.push_back(std::make_unique<ThreadEvents>(threads.size() + 1));
+
+    return threads.back().get();
+}
+
+//-------------------------------------------------------------------------
+
+template<typename Function>
+void
+forEachEvent(
+    const ThreadEvents& thread,
+    Function function)
+{
+    const uint64_t count = thread.count.load(std::memory_order_acquire);
+    const uint64_t available = thread.events.size();
+    const uint64_t first = (count > available) ? count - available : 0;
+
+    for (uint64_t i = count ; i > first ; --i)
+    {
+        const auto& slot = thread.events[(i - 1) % available];
+        const uint64_t sequence = 2 * i;
+
+        if (slot.sequence.load(std::memory_order_acquire) != sequence)
+        {
+            break;
+        }
+
+        const ogsfb32::ProfileEvent event{
+            slot.name.load(std::memory_order_relaxed),
+            slot.start.load(std::memory_order_relaxed),
+            slot.end.load(std::memory_order_relaxed)};
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        // Once an event has been overwritten, so have all older ones.
+
+        if ((slot.sequence.load(std::memory_order_relaxed) != sequence) or
+            not function(event))
+        {
+            break;
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+writeJsonString(
+    std::ostream& os,
+    const char* string)
+{
+    os << '"';
+
+    for (const char* c = string ; *c != '\0' ; ++c)
+    {
+        if ((*c == '"') or (*c == '\\'))
+        {
+            os << '\\';
+        }
+
+        os << *c;
+    }
+
+    os << '"';
+}
+
+//-------------------------------------------------------------------------
+
+}
+
+//=========================================================================
+
+std::atomic<bool> ogsfb32::Profiler::s_enabled{false};
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::Profiler:: enable(
+    bool enabled)
+{
+    s_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+//-------------------------------------------------------------------------
+
+uint64_t
+ogsfb32::Profiler:: now()
+{
+    using namespace std::chrono;
+
+    return duration_cast<nanoseconds>(
+        steady_clock::now().time_since_epoch()).count();
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::Profiler:: record(
+    const char* name,
+    uint64_t start,
+    uint64_t end)
+{
+    if (threadEvents == nullptr)
+    {
+        threadEvents = registerThread();
+    }
+
+    const uint64_t count = threadEvents->count.load(std::memory_order_relaxed);
+
+    auto& slot = threadEvents->events[count % eventsPerThread];
+
+    slot.sequence.store((2 * count) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.start.store(start, std::memory_order_relaxed);
+    slot.end.store(end, std::memory_order_relaxed);
+
+    slot.sequence.store((2 * count) + 2, std::memory_order_release);
+    threadEvents->count.store(count + 1, std::memory_order_release);
+}
+
+//-------------------------------------------------------------------------
+
+uint64_t
+ogsfb32::Profiler:: duration(
+    const std::string& name,
+    uint64_t since)
+{
+    uint64_t total{0};
+
+    std::lock_guard<std::mutex> lock(threadsMutex);
+
+    for (const auto& thread : threads)
+    {
+        forEachEvent(*thread, [&](const ProfileEvent& event)
+        {
+            if (event.end < since)
+            {
+                return false;
+            }
+
+            if ((event.start >= since) and (name == event.name))
+            {
+                total += event.end - event.start;
+            }
+
+            return true;
+        });
+    }
+
+    return total;
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::Profiler:: writeChromeTrace(
+    const std::string& filename)
+{
+    std::ofstream ofs{filename};
+
+    if (not ofs.is_open())
+    {
+        throw std::system_error{errno,
+                                std::system_category(),
+                                "cannot open trace file " + filename};
+    }
+
+    const auto pid = ::getpid();
+    bool first = true;
+
+    ofs << std::fixed << std::setprecision(3);
+    ofs << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+    std::lock_guard<std::mutex> lock(threadsMutex);
+
+    for (const auto& thread : threads)
+    {
+        forEachEvent(*thread, [&](const ProfileEvent& event)
+        {
+            if (not first)
+            {
+                ofs << ",\n";
+            }
+
+            first = false;
+
+            ofs << "{\"name\":";
+            writeJsonString(ofs, event.name);
+            ofs << ",\"ph\":\"X\""
+                << ",\"ts\":" << (event.start / 1000.0)
+                << ",\"dur\":" << ((event.end - event.start) / 1000.0)
+                << ",\"pid\":" << pid
+                << ",\"tid\":" << thread->threadId
+                << "}";
+
+            return true;
+        });
+    }
+
+    ofs << "\n]}\n";
+}
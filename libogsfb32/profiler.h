@@ -0,0 +1,117 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+//-------------------------------------------------------------------------
+
+namespace ogsfb32
+{
+
+//-------------------------------------------------------------------------
+
+struct ProfileEvent
+{
+    const char* name;
+    uint64_t start;
+    uint64_t end;
+};
+
+//-------------------------------------------------------------------------
+
+// Events are kept in a fixed size ring buffer per thread, so recording
+// never allocates or takes a lock after the first event on a thread.
+// Times are nanoseconds from std::chrono::steady_clock.
+
+class Profiler
+{
+public:
+
+    static constexpr size_t eventsPerThread{16384};
+
+    static bool
+    isEnabled()
+    {
+        return s_enabled.load(std::memory_order_relaxed);
+    }
+
+    static void enable(bool enabled = true);
+
+    static uint64_t now();
+
+    static void record(const char* name, uint64_t start, uint64_t end);
+
+    static uint64_t duration(const std::string& name, uint64_t since);
+
+    static void writeChromeTrace(const std::string& filename);
+
+private:
+
+    static std::atomic<bool> s_enabled;
+};
+
+//-------------------------------------------------------------------------
+
+class ProfileScope
+{
+public:
+
+    explicit ProfileScope(const char* name)
+    :
+        m_name{name},
+        m_start{(Profiler::isEnabled()) ? Profiler::now() : 0}
+    {
+    }
+
+    ~ProfileScope()
+    {
+        if (m_start != 0)
+        {
+            Profiler::record(m_name, m_start, Profiler::now());
+        }
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+
+    const char* m_name;
+    uint64_t m_start;
+};
+
+//-------------------------------------------------------------------------
+
+} // namespace ogsfb32
+
@@ -0,0 +1,304 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <algorithm>
+
+#include "scaler.h"
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+
+//-------------------------------------------------------------------------
+
+// Blends two pixels with a weight out of 256 for the second. Red and blue
+// are blended together, as the weights add up to 256 they can't overflow
+// into each other.
+
+uint32_t
+blend(
+    uint32_t pixel0,
+    uint32_t pixel1,
+    uint32_t weight)
+{
+    const uint32_t weight0 = 256 - weight;
+
+    const uint32_t redBlue = (((pixel0 & 0xFF00FF) * weight0) +
+                              ((pixel1 & 0xFF00FF) * weight)) >> 8;
+    const uint32_t green = (((pixel0 & 0x00FF00) * weight0) +
+                            ((pixel1 & 0x00FF00) * weight)) >> 8;
+
+    return (redBlue & 0xFF00FF) | (green & 0x00FF00);
+}
+
+//-------------------------------------------------------------------------
+
+}
+
+//-------------------------------------------------------------------------
+
+ogsfb32::Scaler:: Scaler(
+    int32_t sourceWidth,
+    int32_t sourceHeight,
+    int32_t destinationWidth,
+    int32_t destinationHeight,
+    Filter filter)
+:
+    m_sourceWidth{sourceWidth},
+    m_sourceHeight{sourceHeight},
+    m_destinationWidth{destinationWidth},
+    m_destinationHeight{destinationHeight},
+    m_filter{filter},
+    m_ratio{0},
+    m_columns{samples(sourceWidth, destinationWidth, filter)},
+    m_rows{samples(sourceHeight, destinationHeight, filter)},
+    m_rowBuffers{},
+    m_rowIndex{ -1, -1 }
+{
+    if ((filter == NEAREST) and ((destinationWidth % sourceWidth) == 0))
+    {
+        m_ratio = destinationWidth / sourceWidth;
+    }
+
+    if (filter == BILINEAR)
+    {
+        for (auto& buffer : m_rowBuffers)
+        {
+            buffer.resize(destinationWidth);
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+
+ogsfb32::Scaler::Area
+ogsfb32::Scaler:: scale(
+    const uint32_t* source,
+    int32_t sourceStride,
+    uint32_t* destination,
+    int32_t destinationStride,
+    const Area& area)
+{
+    const auto [x1, x2] = range(m_columns,
+                                std::max(area.x1, 0),
+                                std::min(area.x2, m_sourceWidth));
+    const auto [y1, y2] = range(m_rows,
+                                std::max(area.y1, 0),
+                                std::min(area.y2, m_sourceHeight));
+
+    if ((x1 >= x2) or (y1 >= y2))
+    {
+        return Area{ 0, 0, 0, 0 };
+    }
+
+    // The source may have changed since the last call.
+
+    m_rowIndex[0] = -1;
+    m_rowIndex[1] = -1;
+
+    for (int32_t y = y1 ; y < y2 ; ++y)
+    {
+        const Sample& row = m_rows[y];
+        uint32_t* line = destination + (y * destinationStride);
+
+        if (m_filter == NEAREST)
+        {
+            // Rows from the same source row are the same, so copy them.
+
+            if ((y > y1) and (m_rows[y - 1].index0 == row.index0))
+            {
+                const uint32_t* previous = line - destinationStride;
+                std::copy(previous + x1, previous + x2, line + x1);
+            }
+            else
+            {
+                scaleRow(source + (row.index0 * sourceStride), line, x1, x2);
+            }
+        }
+        else
+        {
+            const uint32_t* top = scaledRow(source, sourceStride, row.index0, x1, x2);
+
+            if (row.weight == 0)
+            {
+                std::copy(top + x1, top + x2, line + x1);
+            }
+            else
+            {
+                const uint32_t* bottom = scaledRow(source,
+                                                   sourceStride,
+                                                   row.index1,
+                                                   x1,
+                                                   x2);
+
+                for (int32_t x = x1 ; x < x2 ; ++x)
+                {
+                    line[x] = blend(top[x], bottom[x], row.weight);
+                }
+            }
+        }
+    }
+
+    return Area{ x1, y1, x2, y2 };
+}
+
+//-------------------------------------------------------------------------
+
+std::vector<ogsfb32::Scaler::Sample>
+ogsfb32::Scaler:: samples(
+    int32_t from,
+    int32_t to,
+    Filter filter)
+{
+    // Pixel centres line up, so destination pixel i is at source position
+    // ((i + 0.5) * from / to) - 0.5, here in 8 bit fixed point.
+
+    std::vector<Sample> samples;
+    samples.reserve(to);
+
+    for (int64_t i = 0 ; i < to ; ++i)
+    {
+        if (filter == NEAREST)
+        {
+            const auto index = static_cast<int32_t>(((2 * i + 1) * from) / (2 * to));
+            samples.push_back(Sample{ index, index, 0 });
+        }
+        else
+        {
+            const int64_t position = std::max<int64_t>(
+                (((2 * i + 1) * from * 256) / (2 * to)) - 128, 0);
+
+            auto index = static_cast<int32_t>(position >> 8);
+            auto weight = static_cast<uint32_t>(position & 0xFF);
+
+            if (index >= (from - 1))
+            {
+                index = from - 1;
+                weight = 0;
+            }
+
+            samples.push_back(Sample{ index, std::min(index + 1, from - 1), weight });
+        }
+    }
+
+    return samples;
+}
+
+//-------------------------------------------------------------------------
+
+std::pair<int32_t, int32_t>
+ogsfb32::Scaler:: range(
+    const std::vector<Sample>& samples,
+    int32_t low,
+    int32_t high)
+{
+    // The samples that read anything from low up to high.
+
+    const auto begin = std::partition_point(samples.begin(),
+                                            samples.end(),
+                                            [low](const Sample& sample)
+                                            {
+                                                return sample.index1 < low;
+                                            });
+    const auto end = std::partition_point(begin,
+                                          samples.end(),
+                                          [high](const Sample& sample)
+                                          {
+                                              return sample.index0 < high;
+                                          });
+
+    return std::make_pair(static_cast<int32_t>(begin - samples.begin()),
+                          static_cast<int32_t>(end - samples.begin()));
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::Scaler:: scaleRow(
+    const uint32_t* source,
+    uint32_t* destination,
+    int32_t x1,
+    int32_t x2) const
+{
+    if (m_ratio > 0)
+    {
+        for (int32_t x = x1 ; x < x2 ; )
+        {
+            const int32_t end = std::min(x2, ((x / m_ratio) + 1) * m_ratio);
+            std::fill(destination + x, destination + end, source[x / m_ratio]);
+            x = end;
+        }
+    }
+    else if (m_filter == NEAREST)
+    {
+        for (int32_t x = x1 ; x < x2 ; ++x)
+        {
+            destination[x] = source[m_columns[x].index0];
+        }
+    }
+    else
+    {
+        for (int32_t x = x1 ; x < x2 ; ++x)
+        {
+            const Sample& column = m_columns[x];
+            destination[x] = blend(source[column.index0],
+                                   source[column.index1],
+                                   column.weight);
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+
+const uint32_t*
+ogsfb32::Scaler:: scaledRow(
+    const uint32_t* source,
+    int32_t sourceStride,
+    int32_t y,
+    int32_t x1,
+    int32_t x2)
+{
+    // Destination rows are scaled in order, so each source row is used
+    // by a few destination rows in turn. Keep the last two scaled across.
+
+    for (int i = 0 ; i < 2 ; ++i)
+    {
+        if (m_rowIndex[i] == y)
+        {
+            return m_rowBuffers[i].data();
+        }
+    }
+
+    const int i = (m_rowIndex[0] < m_rowIndex[1]) ? 0 : 1;
+
+    m_rowIndex[i] = y;
+    scaleRow(source + (y * sourceStride), m_rowBuffers[i].data(), x1, x2);
+
+    return m_rowBuffers[i].data();
+}
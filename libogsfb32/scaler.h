@@ -0,0 +1,136 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+//-------------------------------------------------------------------------
+
+namespace ogsfb32
+{
+
+//-------------------------------------------------------------------------
+
+// Scales 32 bit per pixel images of a fixed size. NEAREST repeats pixels,
+// which for a whole number ratio is just copying; BILINEAR blends the four
+// nearest source pixels. The alpha byte is not kept by BILINEAR.
+
+class Scaler
+{
+public:
+
+    enum Filter
+    {
+        NEAREST,
+        BILINEAR
+    };
+
+    // A rectangle from (x1, y1) up to but not including (x2, y2).
+
+    struct Area
+    {
+        int32_t x1;
+        int32_t y1;
+        int32_t x2;
+        int32_t y2;
+    };
+
+    Scaler(
+        int32_t sourceWidth,
+        int32_t sourceHeight,
+        int32_t destinationWidth,
+        int32_t destinationHeight,
+        Filter filter);
+
+    Filter getFilter() const { return m_filter; }
+
+    // Scales the part of the destination that depends on the given area
+    // of the source, and returns that part of the destination. Strides
+    // are in pixels.
+
+    Area
+    scale(
+        const uint32_t* source,
+        int32_t sourceStride,
+        uint32_t* destination,
+        int32_t destinationStride,
+        const Area& area);
+
+private:
+
+    struct Sample
+    {
+        int32_t index0;
+        int32_t index1;
+        uint32_t weight;
+    };
+
+    static std::vector<Sample> samples(int32_t from, int32_t to, Filter filter);
+
+    static std::pair<int32_t, int32_t>
+    range(
+        const std::vector<Sample>& samples,
+        int32_t low,
+        int32_t high);
+
+    void
+    scaleRow(
+        const uint32_t* source,
+        uint32_t* destination,
+        int32_t x1,
+        int32_t x2) const;
+
+    const uint32_t*
+    scaledRow(
+        const uint32_t* source,
+        int32_t sourceStride,
+        int32_t y,
+        int32_t x1,
+        int32_t x2);
+
+    int32_t m_sourceWidth;
+    int32_t m_sourceHeight;
+    int32_t m_destinationWidth;
+    int32_t m_destinationHeight;
+    Filter m_filter;
+    int32_t m_ratio;
+    std::vector<Sample> m_columns;
+    std::vector<Sample> m_rows;
+    std::vector<uint32_t> m_rowBuffers[2];
+    int32_t m_rowIndex[2];
+};
+
+//-------------------------------------------------------------------------
+
+} // namespace ogsfb32
+
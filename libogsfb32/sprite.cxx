@@ -0,0 +1,207 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <algorithm>
+
+#include "sprite.h"
+
+//-------------------------------------------------------------------------
+
+ogsfb32::Sprite:: Sprite(
+    const Image8880& image,
+    const Animation& animation)
+:
+    m_image(image),
+    m_animation(animation),
+    m_animationElapsed{0},
+    m_from{0, 0},
+    m_to{0, 0},
+    m_moveElapsed{0},
+    m_moveDuration{0},
+    m_visible{true},
+    m_dirty{true},
+    m_drawn{false},
+    m_drawnPosition{0, 0}
+{
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::Sprite:: setAnimation(
+    const Animation& animation)
+{
+    m_animation = animation;
+    m_animationElapsed = std::chrono::milliseconds{0};
+    m_dirty = true;
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::Sprite:: setPosition(
+    const FB8880Point& p)
+{
+    m_from = p;
+    m_to = p;
+    m_moveElapsed = std::chrono::milliseconds{0};
+    m_moveDuration = std::chrono::milliseconds{0};
+    m_dirty = true;
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::Sprite:: moveTo(
+    const FB8880Point& p,
+    std::chrono::milliseconds duration)
+{
+    // Start from wherever the sprite is now, so a new move made part way
+    // through the last one doesn't jump.
+
+    m_from = getPosition();
+    m_to = p;
+    m_moveElapsed = std::chrono::milliseconds{0};
+    m_moveDuration = duration;
+    m_dirty = true;
+}
+
+//-------------------------------------------------------------------------
+
+ogsfb32::FB8880Point
+ogsfb32::Sprite:: getPosition() const
+{
+    if (not isMoving())
+    {
+        return m_to;
+    }
+
+    const auto t = m_moveElapsed.count();
+    const auto d = m_moveDuration.count();
+
+    return FB8880Point{
+        static_cast<int32_t>(m_from.x() + ((m_to.x() - m_from.x()) * t) / d),
+        static_cast<int32_t>(m_from.y() + ((m_to.y() - m_from.y()) * t) / d)};
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::Sprite:: show()
+{
+    if (not m_visible)
+    {
+        m_visible = true;
+        m_dirty = true;
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::Sprite:: hide()
+{
+    if (m_visible)
+    {
+        m_visible = false;
+        m_dirty = true;
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::Sprite:: update(
+    std::chrono::milliseconds elapsed)
+{
+    const auto frame = m_animation.frameAt(m_animationElapsed);
+    const auto position = getPosition();
+
+    m_animationElapsed += elapsed;
+
+    if (isMoving())
+    {
+        m_moveElapsed = std::min(m_moveElapsed + elapsed, m_moveDuration);
+    }
+
+    const auto next = getPosition();
+
+    if ((m_animation.frameAt(m_animationElapsed) != frame) or
+        (next.x() != position.x()) or
+        (next.y() != position.y()))
+    {
+        m_dirty = true;
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+ogsfb32::Sprite:: draw(
+    FrameBuffer8880& fb)
+{
+    m_dirty = false;
+    m_drawn = m_visible;
+
+    if (not m_visible)
+    {
+        return;
+    }
+
+    const auto position = getPosition();
+    m_drawnPosition = position;
+    m_image.setFrame(m_animation.frameAt(m_animationElapsed));
+
+    for (int16_t i = 0 ; i < m_image.getWidth() ; ++i)
+    {
+        uint32_t* line = fb.getColumn(position.x() + i);
+
+        if (line == nullptr)
+        {
+            continue;
+        }
+
+        // Image columns are stored right to left.
+
+        const uint32_t* pixels = m_image.getColumn(m_image.getWidth() - 1 - i);
+
+        for (int16_t j = 0 ; j < m_image.getHeight() ; ++j)
+        {
+            const int32_t y = position.y() + j;
+
+            if ((pixels[j] != transparent) and
+                (y >= 0) and
+                (y < fb.getHeight()))
+            {
+                line[y] = pixels[j];
+            }
+        }
+    }
+
+    fb.addDamage(position, m_image.getWidth(), m_image.getHeight());
+}
@@ -0,0 +1,105 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <chrono>
+#include <cstdint>
+
+#include "animation.h"
+#include "framebuffer8880.h"
+#include "image8880.h"
+
+//-------------------------------------------------------------------------
+
+namespace ogsfb32
+{
+
+//-------------------------------------------------------------------------
+
+// An animated image that can glide from one position to another over a
+// set time. Pixels of the transparent colour are not drawn, so the sprite
+// can be drawn over a background. A sprite is dirty when it needs to be
+// drawn again; before it is, the area it was last drawn in (see
+// isDrawn() and getDrawnPosition()) has to be restored by the caller.
+// Drawing adds the sprite's area to the frame buffer damage.
+
+class Sprite
+{
+public:
+
+    static constexpr uint32_t transparent{0xFF000000};
+
+    explicit Sprite(const Image8880& image,
+                    const Animation& animation = Animation{});
+
+    int16_t getWidth() const { return m_image.getWidth(); }
+    int16_t getHeight() const { return m_image.getHeight(); }
+
+    void setAnimation(const Animation& animation);
+
+    void setPosition(const FB8880Point& p);
+    void moveTo(const FB8880Point& p, std::chrono::milliseconds duration);
+
+    FB8880Point getPosition() const;
+    bool isMoving() const { return m_moveElapsed < m_moveDuration; }
+
+    void show();
+    void hide();
+    bool isVisible() const { return m_visible; }
+
+    void update(std::chrono::milliseconds elapsed);
+
+    bool isDirty() const { return m_dirty; }
+    bool isDrawn() const { return m_drawn; }
+    const FB8880Point& getDrawnPosition() const { return m_drawnPosition; }
+
+    void draw(FrameBuffer8880& fb);
+
+private:
+
+    Image8880 m_image;
+    Animation m_animation;
+    std::chrono::milliseconds m_animationElapsed;
+
+    FB8880Point m_from;
+    FB8880Point m_to;
+    std::chrono::milliseconds m_moveElapsed;
+    std::chrono::milliseconds m_moveDuration;
+
+    bool m_visible;
+    bool m_dirty;
+    bool m_drawn;
+    FB8880Point m_drawnPosition;
+};
+
+//-------------------------------------------------------------------------
+
+} // namespace ogsfb32
@@ -0,0 +1,297 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <getopt.h>
+#include <libgen.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "bitLifeEngine.h"
+#include "byteLifeEngine.h"
+#include "patternLoader.h"
+#include "tileLifeEngine.h"
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+
+//-------------------------------------------------------------------------
+
+void
+printUsage(
+    std::ostream& os,
+    const std::string& name)
+{
+    os << "\n";
+    os << "Usage: " << name << " <options>\n";
+    os << "\n";
+    os << "    --generations,-g <count> - generations per run";
+    os << " (default is 1000)\n";
+    os << "    --help,-h - print usage and exit\n";
+    os << "    --pattern,-f <file> - run a pattern file";
+    os << " instead of a random soup\n";
+    os << "    --size,-s <cells> - width and height of the board";
+    os << " (default is 480)\n";
+    os << "    --threads,-n <count> - maximum number of threads";
+    os << " (default is the number of cores)\n";
+    os << "\n";
+}
+
+//-------------------------------------------------------------------------
+
+void
+seed(
+    LifeEngine& engine,
+    int extent,
+    const char* pattern)
+{
+    if (pattern != nullptr)
+    {
+        PatternLoader::load(pattern, engine);
+        return;
+    }
+
+    std::mt19937 generator{42};
+    std::bernoulli_distribution alive{0.5};
+
+    const int width = std::min(extent, engine.width());
+    const int height = std::min(extent, engine.height());
+    const int x = (engine.width() - width) / 2;
+    const int y = (engine.height() - height) / 2;
+
+    engine.clear();
+
+    for (int row = 0 ; row < height ; ++row)
+    {
+        for (int col = 0 ; col < width ; ++col)
+        {
+            if (alive(generator))
+            {
+                engine.setCell(x + col, y + row);
+            }
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+
+std::vector<uint8_t>
+snapshot(
+    const LifeEngine& engine)
+{
+    const int height = engine.height();
+    std::vector<uint8_t> codes(engine.width() * height);
+
+    for (int col = 0 ; col < engine.width() ; ++col)
+    {
+        engine.getColumn(col, 0, height, codes.data() + (col * height));
+    }
+
+    return codes;
+}
+
+//-------------------------------------------------------------------------
+
+double
+generationsPerSecond(
+    LifeEngine& engine,
+    int generations,
+    int extent,
+    const char* pattern)
+{
+    seed(engine, extent, pattern);
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (int generation = 0 ; generation < generations ; ++generation)
+    {
+        engine.iterate();
+    }
+
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    return generations / elapsed.count();
+}
+
+//-------------------------------------------------------------------------
+
+}
+
+//-------------------------------------------------------------------------
+
+int
+main(
+    int argc,
+    char *argv[])
+{
+    int generations = 1000;
+    int size = 480;
+    int maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    const char* pattern = nullptr;
+    char* program = basename(argv[0]);
+
+    //---------------------------------------------------------------------
+
+    static const char* sopts = "f:g:hn:s:";
+    static struct option lopts[] =
+    {
+        { "generations", required_argument, nullptr, 'g' },
+        { "help", no_argument, nullptr, 'h' },
+        { "pattern", required_argument, nullptr, 'f' },
+        { "size", required_argument, nullptr, 's' },
+        { "threads", required_argument, nullptr, 'n' },
+        { nullptr, no_argument, nullptr, 0 }
+    };
+
+    int opt = 0;
+
+    while ((opt = getopt_long(argc, argv, sopts, lopts, nullptr)) != -1)
+    {
+        switch (opt)
+        {
+        case 'f':
+
+            pattern = optarg;
+
+            break;
+
+        case 'g':
+
+            generations = std::max(1, std::atoi(optarg));
+
+            break;
+
+        case 'h':
+
+            printUsage(std::cout, program);
+            ::exit(EXIT_SUCCESS);
+
+            break;
+
+        case 'n':
+
+            maxThreads = std::max(1, std::atoi(optarg));
+
+            break;
+
+        case 's':
+
+            size = std::max(3, std::atoi(optarg));
+
+            break;
+
+        default:
+
+            printUsage(std::cerr, program);
+            ::exit(EXIT_FAILURE);
+
+            break;
+        }
+    }
+
+    //---------------------------------------------------------------------
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << size << "x" << size << " cells, ";
+    std::cout << generations << " generations\n\n";
+
+    if (size == ByteLifeEngine::WIDTH and size == ByteLifeEngine::HEIGHT)
+    {
+        ByteLifeEngine byteEngine;
+        const double rate = generationsPerSecond(byteEngine, generations, size, pattern);
+        std::cout << "byte engine: " << rate << " generations/s\n\n";
+    }
+
+    BitLifeEngine serial{size, size};
+    const double serialRate = generationsPerSecond(serial, generations, size, pattern);
+    const auto expected = snapshot(serial);
+
+    std::cout << "threads  generations/s  speedup  result\n";
+
+    bool identical = true;
+
+    for (int threads = 1 ; threads <= maxThreads ; ++threads)
+    {
+        BitLifeEngine engine{size, size, threads};
+        const double rate = generationsPerSecond(engine, generations, size, pattern);
+        const bool same = (snapshot(engine) == expected);
+        identical = identical and same;
+
+        std::cout << std::setw(7) << engine.threads()
+                  << std::setw(15) << rate
+                  << std::setw(8) << (rate / serialRate) << "x"
+                  << "  " << ((same) ? "identical" : "DIFFERENT") << "\n";
+    }
+
+    //---------------------------------------------------------------------
+
+    // Compare the tile engine with the bit engine on a soup filling the
+    // board and on a small soup in the middle of an otherwise empty board,
+    // or on the pattern.
+
+    if ((size % TileLifeEngine::tileSize) == 0)
+    {
+        std::vector<int> extents{ size };
+
+        if (pattern == nullptr)
+        {
+            extents.push_back(TileLifeEngine::tileSize);
+        }
+
+        std::cout << "\n   soup   bit engine  tile engine  result\n";
+
+        for (const int extent : extents)
+        {
+            BitLifeEngine bit{size, size};
+            TileLifeEngine tile{size, size};
+
+            const double bitRate = generationsPerSecond(bit, generations, extent, pattern);
+            const double tileRate = generationsPerSecond(tile, generations, extent, pattern);
+            const bool same = (snapshot(tile) == snapshot(bit));
+            identical = identical and same;
+
+            std::cout << std::setw(7) << extent
+                      << std::setw(13) << bitRate
+                      << std::setw(13) << tileRate
+                      << "  " << ((same) ? "identical" : "DIFFERENT") << "\n";
+        }
+    }
+
+    return (identical) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
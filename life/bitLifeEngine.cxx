@@ -0,0 +1,331 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <algorithm>
+
+#include "bitLifeEngine.h"
+#include "lifeRule.h"
+
+//-------------------------------------------------------------------------
+
+BitLifeEngine::BitLifeEngine(
+    int width,
+    int height,
+    int threads)
+:
+    m_width{width},
+    m_height{height},
+    m_words{(width + 63) / 64},
+    m_stride{m_words + 2},
+    m_lastWordMask{(width % 64) ? (uint64_t{1} << (width % 64)) - 1 : ~uint64_t{0}},
+    m_current{0},
+    m_grids{},
+    m_statisticsEnabled{false},
+    m_statistics{},
+    m_bandStatistics{},
+    m_pool{}
+{
+    for (auto& grid : m_grids)
+    {
+        grid.resize(m_stride * m_height, 0);
+    }
+
+    threads = std::min(threads, m_height);
+
+    if (threads > 1)
+    {
+        m_pool = std::make_unique<WorkerPool>(threads);
+    }
+
+    m_bandStatistics.resize(std::max(threads, 1));
+}
+
+//-------------------------------------------------------------------------
+
+void
+BitLifeEngine::clear()
+{
+    for (auto& grid : m_grids)
+    {
+        std::fill(grid.begin(), grid.end(), 0);
+    }
+
+    m_statistics = LifeStatistics{};
+}
+
+//-------------------------------------------------------------------------
+
+void
+BitLifeEngine::setCell(
+    int col,
+    int row)
+{
+    uint64_t* cells = this->row(m_current, row);
+    const int word = col / 64;
+    const uint64_t mask = (word == m_words - 1) ? m_lastWordMask : ~uint64_t{0};
+    const uint64_t before = cells[1 + word] & mask;
+    const uint64_t after = before | (uint64_t{1} << (col % 64));
+
+    if (after != before)
+    {
+        const uint64_t index = (row * m_words) + word;
+
+        cells[1 + word] |= after;
+
+        ++m_statistics.population;
+        m_statistics.hash += cellsHash(after, index) - cellsHash(before, index);
+    }
+
+    updateHalo(cells);
+}
+
+//-------------------------------------------------------------------------
+
+void
+BitLifeEngine::updateHalo(
+    uint64_t* cells)
+{
+    uint64_t* words = cells + 1;
+    const int lastCol = m_width - 1;
+    const uint64_t first = words[0] & 1;
+    const uint64_t last = (words[lastCol / 64] >> (lastCol % 64)) & 1;
+
+    cells[0] = last << 63;
+
+    if ((m_width % 64) == 0)
+    {
+        cells[m_words + 1] = first;
+    }
+    else
+    {
+        words[m_words - 1] &= m_lastWordMask;
+        words[m_words - 1] |= first << (m_width % 64);
+        cells[m_words + 1] = 0;
+    }
+}
+
+//-------------------------------------------------------------------------
+
+template <bool keepStatistics>
+void
+BitLifeEngine::stepRows(
+    int first,
+    int last,
+    LifeStatistics& statistics)
+{
+    const int next = m_current ^ 1;
+    int64_t births = 0;
+    int64_t deaths = 0;
+    uint64_t hash = 0;
+
+    for (int r = first ; r < last ; ++r)
+    {
+        const uint64_t* above = row(m_current, (r == 0) ? m_height - 1 : r - 1);
+        const uint64_t* middle = row(m_current, r);
+        const uint64_t* below = row(m_current, (r == m_height - 1) ? 0 : r + 1);
+        uint64_t* result = row(next, r);
+
+        for (int i = 1 ; i <= m_words ; ++i)
+        {
+            const uint64_t aw = (above[i] << 1) | (above[i - 1] >> 63);
+            const uint64_t ac = above[i];
+            const uint64_t ae = (above[i] >> 1) | (above[i + 1] << 63);
+
+            const uint64_t mw = (middle[i] << 1) | (middle[i - 1] >> 63);
+            const uint64_t mc = middle[i];
+            const uint64_t me = (middle[i] >> 1) | (middle[i + 1] << 63);
+
+            const uint64_t bw = (below[i] << 1) | (below[i - 1] >> 63);
+            const uint64_t bc = below[i];
+            const uint64_t be = (below[i] >> 1) | (below[i + 1] << 63);
+
+            result[i] = lifeRule(aw, ac, ae, mw, mc, me, bw, bc, be);
+
+            if (not keepStatistics)
+            {
+                continue;
+            }
+
+            const uint64_t mask = (i == m_words) ? m_lastWordMask : ~uint64_t{0};
+            const uint64_t before = mc & mask;
+            const uint64_t after = result[i] & mask;
+
+            births += __builtin_popcountll(after & ~before);
+            deaths += __builtin_popcountll(before & ~after);
+            hash += cellsHash(after, (r * m_words) + i - 1);
+        }
+
+        updateHalo(result);
+    }
+
+    statistics.births = births;
+    statistics.deaths = deaths;
+    statistics.hash = hash;
+}
+
+//-------------------------------------------------------------------------
+
+void
+BitLifeEngine::step(
+    int first,
+    int last,
+    LifeStatistics& statistics)
+{
+    if (m_statisticsEnabled)
+    {
+        stepRows<true>(first, last, statistics);
+    }
+    else
+    {
+        stepRows<false>(first, last, statistics);
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+BitLifeEngine::iterate()
+{
+    if (m_pool)
+    {
+        const int bands = m_pool->size();
+
+        m_pool->run([this, bands](int band)
+        {
+            step((m_height * band) / bands,
+                 (m_height * (band + 1)) / bands,
+                 m_bandStatistics[band]);
+        });
+    }
+    else
+    {
+        step(0, m_height, m_bandStatistics[0]);
+    }
+
+    m_current ^= 1;
+
+    ++m_statistics.generation;
+
+    if (not m_statisticsEnabled)
+    {
+        return;
+    }
+
+    m_statistics.births = 0;
+    m_statistics.deaths = 0;
+    m_statistics.hash = 0;
+
+    for (const auto& band : m_bandStatistics)
+    {
+        m_statistics.births += band.births;
+        m_statistics.deaths += band.deaths;
+        m_statistics.hash += band.hash;
+    }
+
+    m_statistics.population += m_statistics.births - m_statistics.deaths;
+}
+
+//-------------------------------------------------------------------------
+
+void
+BitLifeEngine::enableStatistics(
+    bool enable)
+{
+    // The counts are not kept up to date while disabled, so recount.
+
+    if (enable and not m_statisticsEnabled)
+    {
+        m_statistics.population = 0;
+        m_statistics.births = 0;
+        m_statistics.deaths = 0;
+        m_statistics.hash = 0;
+
+        for (int r = 0 ; r < m_height ; ++r)
+        {
+            const uint64_t* cells = row(m_current, r);
+
+            for (int i = 1 ; i <= m_words ; ++i)
+            {
+                const uint64_t mask = (i == m_words) ? m_lastWordMask : ~uint64_t{0};
+                const uint64_t word = cells[i] & mask;
+
+                m_statistics.population += __builtin_popcountll(word);
+                m_statistics.hash += cellsHash(word, (r * m_words) + i - 1);
+            }
+        }
+    }
+
+    m_statisticsEnabled = enable;
+}
+
+//-------------------------------------------------------------------------
+
+int
+BitLifeEngine::alive(
+    int col,
+    int row) const
+{
+    return (this->row(m_current, row)[1 + (col / 64)] >> (col % 64)) & 1;
+}
+
+//-------------------------------------------------------------------------
+
+void
+BitLifeEngine::getColumn(
+    int col,
+    int row,
+    int count,
+    uint8_t* codes) const
+{
+    col = ((col % m_width) + m_width) % m_width;
+    row = ((row % m_height) + m_height) % m_height;
+
+    const int left = (col == 0) ? m_width - 1 : col - 1;
+    const int right = (col == m_width - 1) ? 0 : col + 1;
+
+    auto columnSum = [&](int r)
+    {
+        return alive(left, r) + alive(col, r) + alive(right, r);
+    };
+
+    int previous = columnSum((row == 0) ? m_height - 1 : row - 1);
+    int current = columnSum(row);
+
+    for (int i = 0 ; i < count ; ++i)
+    {
+        const int below = (row == m_height - 1) ? 0 : row + 1;
+        const int next = columnSum(below);
+        const int self = alive(col, row);
+
+        codes[i] = (self << aliveCellShift) | (previous + current + next - self);
+
+        previous = current;
+        current = next;
+        row = below;
+    }
+}
@@ -0,0 +1,108 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "lifeEngine.h"
+#include "workerPool.h"
+
+//-------------------------------------------------------------------------
+
+// Stores 64 cells per word and computes a generation with bit-sliced
+// adders. Each row has a halo word at either end (and a halo bit in
+// any unused part of the last word) holding the cell from the other
+// side of the torus, so the inner loop has no wraparound tests.
+//
+// With more than one thread the rows are split into bands, one per
+// thread. Each band reads the rows either side of it from the current
+// grid and writes only its own rows of the next grid, so the result is
+// identical to the single threaded engine.
+
+class BitLifeEngine
+:
+    public LifeEngine
+{
+public:
+
+    BitLifeEngine(int width, int height, int threads = 1);
+
+    int width() const override { return m_width; }
+    int height() const override { return m_height; }
+
+    void clear() override;
+    void setCell(int col, int row) override;
+    void iterate() override;
+
+    void enableStatistics(bool enable) override;
+    const LifeStatistics& statistics() const override { return m_statistics; }
+
+    void
+    getColumn(
+        int col,
+        int row,
+        int count,
+        uint8_t* codes) const override;
+
+    int threads() const { return (m_pool) ? m_pool->size() : 1; }
+
+private:
+
+    template <bool keepStatistics>
+    void stepRows(int first, int last, LifeStatistics& statistics);
+
+    void step(int first, int last, LifeStatistics& statistics);
+
+    uint64_t* row(int grid, int row) { return m_grids[grid].data() + (row * m_stride); }
+    const uint64_t* row(int grid, int row) const { return m_grids[grid].data() + (row * m_stride); }
+
+    int alive(int col, int row) const;
+    void updateHalo(uint64_t* cells);
+
+    int m_width;
+    int m_height;
+    int m_words;
+    int m_stride;
+    uint64_t m_lastWordMask;
+
+    int m_current;
+    std::array<std::vector<uint64_t>, 2> m_grids;
+
+    bool m_statisticsEnabled;
+    LifeStatistics m_statistics;
+    std::vector<LifeStatistics> m_bandStatistics;
+
+    std::unique_ptr<WorkerPool> m_pool;
+};
+
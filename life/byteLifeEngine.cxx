@@ -0,0 +1,188 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include "byteLifeEngine.h"
+#include "lifeRule.h"
+
+//-------------------------------------------------------------------------
+
+ByteLifeEngine::ByteLifeEngine()
+:
+    m_cells(),
+    m_cellsNext(),
+    m_statistics{}
+{
+}
+
+//-------------------------------------------------------------------------
+
+void
+ByteLifeEngine::updateCell(
+    Cells& cells,
+    int col,
+    int row,
+    int value)
+{
+    uint32_t left = (col == 0) ? WIDTH - 1 :  col - 1;
+    uint32_t right = (col == WIDTH - 1) ?  0 : col + 1;
+    uint32_t above = (row == 0) ? HEIGHT - 1 : row - 1;
+    uint32_t below = (row == HEIGHT - 1) ? 0 : row + 1;
+
+    cells[left + (above * WIDTH)] += value;
+    cells[col + (above * WIDTH)] += value;
+    cells[right + (above * WIDTH)] += value;
+
+    cells[left + (row * WIDTH)] += value;
+    cells[right + (row * WIDTH)] += value;
+
+    cells[left + (below * WIDTH)] += value;
+    cells[col + (below * WIDTH)] += value;
+    cells[right + (below * WIDTH)] += value;
+}
+
+//-------------------------------------------------------------------------
+
+void
+ByteLifeEngine::setCell(
+    Cells& cells,
+    int col,
+    int row)
+{
+    updateCell(cells, col, row, 1);
+    cells[col + (row * WIDTH)] |= aliveCellMask;
+}
+
+//-------------------------------------------------------------------------
+
+void
+ByteLifeEngine::clearCell(
+    Cells& cells,
+    int col,
+    int row)
+{
+    updateCell(cells, col, row, -1);
+    cells[col + (row * WIDTH)] &= ~aliveCellMask;
+}
+
+//-------------------------------------------------------------------------
+
+void
+ByteLifeEngine::clear()
+{
+    m_cells.fill(0);
+    m_cellsNext.fill(0);
+    m_statistics = LifeStatistics{};
+}
+
+//-------------------------------------------------------------------------
+
+void
+ByteLifeEngine::setCell(
+    int col,
+    int row)
+{
+    const int index = col + (row * WIDTH);
+
+    if ((m_cells[index] & aliveCellMask) == 0)
+    {
+        setCell(m_cells, col, row);
+        setCell(m_cellsNext, col, row);
+
+        ++m_statistics.population;
+        m_statistics.hash += cellsHash(1, index);
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+ByteLifeEngine::iterate()
+{
+    int64_t births = 0;
+    int64_t deaths = 0;
+
+    for (int row = 0 ; row < HEIGHT ; ++row)
+    {
+        for (int col = 0 ; col < WIDTH ; ++col)
+        {
+            const int index = col + (row * WIDTH);
+            auto cell = m_cells[index];
+            auto neighbours = cell & ~aliveCellMask;
+            auto alive = cell & aliveCellMask;
+
+            if (alive)
+            {
+                if ((neighbours != 2) && (neighbours != 3))
+                {
+                    clearCell(m_cellsNext, col, row);
+                    m_statistics.hash -= cellsHash(1, index);
+                    ++deaths;
+                }
+            }
+            else
+            {
+                if (neighbours == 3)
+                {
+                    setCell(m_cellsNext, col, row);
+                    m_statistics.hash += cellsHash(1, index);
+                    ++births;
+                }
+            }
+        }
+    }
+
+    m_cells = m_cellsNext;
+
+    ++m_statistics.generation;
+    m_statistics.population += births - deaths;
+    m_statistics.births = births;
+    m_statistics.deaths = deaths;
+}
+
+//-------------------------------------------------------------------------
+
+void
+ByteLifeEngine::getColumn(
+    int col,
+    int row,
+    int count,
+    uint8_t* codes) const
+{
+    col = ((col % WIDTH) + WIDTH) % WIDTH;
+    row = ((row % HEIGHT) + HEIGHT) % HEIGHT;
+
+    for (int i = 0 ; i < count ; ++i)
+    {
+        codes[i] = m_cells[col + (row * WIDTH)];
+
+        if (++row == HEIGHT)
+        {
+            row = 0;
+        }
+    }
+}
@@ -0,0 +1,80 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <array>
+#include <cstdint>
+
+#include "lifeEngine.h"
+
+//-------------------------------------------------------------------------
+
+class ByteLifeEngine
+:
+    public LifeEngine
+{
+public:
+
+    static constexpr int16_t WIDTH{480};
+    static constexpr int16_t HEIGHT{480};
+
+    ByteLifeEngine();
+
+    int width() const override { return WIDTH; }
+    int height() const override { return HEIGHT; }
+
+    void clear() override;
+    void setCell(int col, int row) override;
+    void iterate() override;
+
+    const LifeStatistics& statistics() const override { return m_statistics; }
+
+    void
+    getColumn(
+        int col,
+        int row,
+        int count,
+        uint8_t* codes) const override;
+
+private:
+
+    using Cells = std::array<uint8_t, WIDTH * HEIGHT>;
+
+    static void updateCell(Cells& cells, int col, int row, int value);
+    static void setCell(Cells& cells, int col, int row);
+    static void clearCell(Cells& cells, int col, int row);
+
+    Cells m_cells;
+    Cells m_cellsNext;
+
+    LifeStatistics m_statistics;
+};
+
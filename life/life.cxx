@@ -25,10 +25,18 @@
 //
 //-------------------------------------------------------------------------
 
+#include <algorithm>
 #include <array>
+#include <cstdlib>
 #include <cstring>
+#include <sstream>
 
+#include "bitLifeEngine.h"
+#include "byteLifeEngine.h"
 #include "life.h"
+#include "patternLoader.h"
+#include "profiler.h"
+#include "tileLifeEngine.h"
 
 //-------------------------------------------------------------------------
 
@@ -36,7 +44,62 @@ using namespace ogsfb32;
 
 //-------------------------------------------------------------------------
 
-Life::Life()
+namespace
+{
+
+// Stick deflection is divided by this to give pixels panned per frame,
+// and must pass zoomThreshold to change the zoom.
+
+constexpr int panDivisor{4096};
+constexpr int zoomThreshold{16384};
+
+const char* gosperGliderGun =
+    "x = 36, y = 9\n"
+    "24bo$22bobo$12b2o6b2o12b2o$11bo3bo4b2o12b2o$2o8bo5bo3b2o$"
+    "2o8bo3bob2o4bobo$10bo5bo7bo$11bo3bo$12b2o!";
+
+const char* simkinGliderGun =
+    "x = 33, y = 21\n"
+    "2o5b2o$2o5b2o2$4b2o$4b2o5$22b2ob2o$21bo5bo$21bo6bo2b2o$"
+    "21b3o3bo3b2o$26bo4$20b2o$20bo$21b3o$23bo!";
+
+//-------------------------------------------------------------------------
+
+std::unique_ptr<LifeEngine>
+createEngine(
+    Life::EngineOption engine,
+    int threads,
+    int universe)
+{
+    switch (engine)
+    {
+    case Life::ENGINE_BYTE:
+
+        return std::make_unique<ByteLifeEngine>();
+
+    case Life::ENGINE_TILE:
+
+        universe = (universe > 0) ? universe : Life::defaultTileUniverse;
+        return std::make_unique<TileLifeEngine>(universe, universe);
+
+    case Life::ENGINE_BIT:
+    default:
+
+        universe = (universe > 0) ? universe : Life::WIDTH;
+        return std::make_unique<BitLifeEngine>(universe, universe, threads);
+    }
+}
+
+//-------------------------------------------------------------------------
+
+}
+
+//-------------------------------------------------------------------------
+
+Life::Life(
+    EngineOption engine,
+    int threads,
+    int universe)
 :
     m_display{DISPLAY_CELLS},
     m_populationColours{
@@ -54,234 +117,182 @@ Life::Life()
         0x00000000,
         0x00FFFFFF
     },
-    m_cells(),
-    m_cellsNext(),
-    m_image(WIDTH, HEIGHT)
+    m_engine{createEngine(engine, threads, universe)},
+    m_periodDetector{},
+    m_palettes{},
+    m_renderer(WIDTH, HEIGHT),
+    m_viewX{0},
+    m_viewY{0},
+    m_zoom{1},
+    m_panX{0},
+    m_panY{0},
+    m_zooming{false},
+    m_patterns{},
+    m_pattern{-1}
 {
-}
-
-//-------------------------------------------------------------------------
-
-void
-Life::updateCell(
-    int col,
-    int row,
-    int value)
-{
-    uint32_t left = (col == 0) ? WIDTH - 1 :  col - 1;
-    uint32_t right = (col == WIDTH - 1) ?  0 : col + 1;
-    uint32_t above = (row == 0) ? HEIGHT - 1 : row - 1;
-    uint32_t below = (row == HEIGHT - 1) ? 0 : row + 1;
-
-    m_cellsNext[left + (above * WIDTH)] += value;
-    m_cellsNext[col + (above * WIDTH)] += value;
-    m_cellsNext[right + (above * WIDTH)] += value;
-
-    m_cellsNext[left + (row * WIDTH)] += value;
-    m_cellsNext[right + (row * WIDTH)] += value;
+    for (size_t code = 0 ; code < LifeRenderer::Palette().size() ; ++code)
+    {
+        const auto neighbours = code & ~LifeEngine::aliveCellMask;
+        const auto state = (code & LifeEngine::aliveCellMask) >> LifeEngine::aliveCellShift;
 
-    m_cellsNext[left + (below * WIDTH)] += value;
-    m_cellsNext[col + (below * WIDTH)] += value;
-    m_cellsNext[right + (below * WIDTH)] += value;
+        m_palettes[DISPLAY_CELLS][code] = m_cellColours[state];
+        m_palettes[DISPLAY_POPULATION][code] =
+            m_populationColours[std::min(neighbours, m_populationColours.size() - 1)];
+    }
 }
 
 //-------------------------------------------------------------------------
 
 void
-Life::setCell(
-    int col,
-    int row)
+Life::iterate()
 {
-    updateCell(col, row, 1);
-    m_cellsNext[col + (row * WIDTH)] |= aliveCellMask;
+    ProfileScope profileScope{"iterate"};
+
+    m_engine->iterate();
+    m_periodDetector.update(m_engine->statistics());
 }
 
 //-------------------------------------------------------------------------
 
 void
-Life::clearCell(
-    int col,
-    int row)
+Life::init()
 {
-    updateCell(col, row, -1);
-    m_cellsNext[col + (row * WIDTH)] &= ~aliveCellMask;
-}
+    const int width = std::min<int>(WIDTH, m_engine->width());
+    const int height = std::min<int>(HEIGHT, m_engine->height());
+    const int x = (m_engine->width() - width) / 2;
+    const int y = (m_engine->height() - height) / 2;
 
-//-------------------------------------------------------------------------
+    m_engine->clear();
 
-void
-Life::iterate()
-{
-    for (int row = 0 ; row < HEIGHT ; ++row)
+    for (int row = 0 ; row < height ; ++row)
     {
-        for (int col = 0 ; col < WIDTH ; ++col)
+        for (int col = 0 ; col < width ; ++col)
         {
-            auto cell = m_cells[col + (row * WIDTH)];
-            auto neighbours = cell & ~aliveCellMask;
-            auto alive = cell & aliveCellMask;
-
-            if (alive)
-            {
-                if ((neighbours != 2) && (neighbours != 3))
-                {
-                    clearCell(col, row);
-                }
-            }
-            else
+            if (std::rand() > (RAND_MAX / 2))
             {
-                if (neighbours == 3)
-                {
-                    setCell(col, row);
-                }
+                m_engine->setCell(x + col, y + row);
             }
         }
     }
 
-    m_cells = m_cellsNext;
+    centreView();
 }
 
 //-------------------------------------------------------------------------
 
 void
-Life::init()
+Life::createGosperGliderGun()
 {
-    m_cells.fill(0);
-    m_cellsNext.fill(0);
+    std::istringstream iss{gosperGliderGun};
+    PatternLoader::load(iss, PatternLoader::FORMAT_RLE, *m_engine);
 
-    for (int row = 0 ; row < HEIGHT ; ++row)
-    {
-        for (int col = 0 ; col < WIDTH ; ++col)
-        {
-            if (std::rand() > (RAND_MAX / 2))
-            {
-                setCell(col, row);
-            }
-        }
-    }
+    centreView();
+}
+
+//-------------------------------------------------------------------------
+
+void
+Life::createSimkinGliderGun()
+{
+    std::istringstream iss{simkinGliderGun};
+    PatternLoader::load(iss, PatternLoader::FORMAT_RLE, *m_engine);
 
-    m_cells = m_cellsNext;
+    centreView();
 }
 
 //-------------------------------------------------------------------------
 
 void
-Life::createGosperGliderGun()
+Life::setPatterns(
+    const std::vector<std::string>& patterns)
 {
-    constexpr int x = 222;
-    constexpr int y = 236;
-
-    m_cells.fill(0);
-    m_cellsNext.fill(0);
-
-    setCell(x + 24, y + 0);
-
-    setCell(x + 22, y + 1);
-    setCell(x + 24, y + 1);
-
-    setCell(x + 12, y + 2);
-    setCell(x + 13, y + 2);
-    setCell(x + 20, y + 2);
-    setCell(x + 21, y + 2);
-    setCell(x + 34, y + 2);
-    setCell(x + 35, y + 2);
-
-    setCell(x + 11, y + 3);
-    setCell(x + 15, y + 3);
-    setCell(x + 20, y + 3);
-    setCell(x + 21, y + 3);
-    setCell(x + 34, y + 3);
-    setCell(x + 35, y + 3);
-
-    setCell(x + 0, y + 4);
-    setCell(x + 1, y + 4);
-    setCell(x + 10, y + 4);
-    setCell(x + 16, y + 4);
-    setCell(x + 20, y + 4);
-    setCell(x + 21, y + 4);
-
-    setCell(x + 0, y + 5);
-    setCell(x + 1, y + 5);
-    setCell(x + 10, y + 5);
-    setCell(x + 14, y + 5);
-    setCell(x + 16, y + 5);
-    setCell(x + 17, y + 5);
-    setCell(x + 22, y + 5);
-    setCell(x + 24, y + 5);
-
-    setCell(x + 10, y + 6);
-    setCell(x + 16, y + 6);
-    setCell(x + 24, y + 6);
-
-    setCell(x + 11, y + 7);
-    setCell(x + 15, y + 7);
-
-    setCell(x + 12, y + 8);
-    setCell(x + 13, y + 8);
-
-    m_cells = m_cellsNext;
+    m_patterns = patterns;
+    m_pattern = -1;
 }
 
 //-------------------------------------------------------------------------
 
 void
-Life::createSimkinGliderGun()
+Life::loadPattern(
+    int step)
 {
-    constexpr int x = 225;
-    constexpr int y = 230;
+    if (m_patterns.empty())
+    {
+        return;
+    }
 
-    m_cells.fill(0);
-    m_cellsNext.fill(0);
+    const int count = static_cast<int>(m_patterns.size());
 
-    setCell(x + 0, y + 0);
-    setCell(x + 1, y + 0);
-    setCell(x + 7, y + 0);
-    setCell(x + 8, y + 0);
+    m_pattern = (((m_pattern + step) % count) + count) % count;
 
-    setCell(x + 0, y + 1);
-    setCell(x + 1, y + 1);
-    setCell(x + 7, y + 1);
-    setCell(x + 8, y + 1);
+    PatternLoader::load(m_patterns[m_pattern], *m_engine);
 
-    setCell(x + 4, y + 3);
-    setCell(x + 5, y + 3);
+    centreView();
+}
 
-    setCell(x + 4, y + 4);
-    setCell(x + 5, y + 4);
+//-------------------------------------------------------------------------
 
-    setCell(x + 22, y + 9);
-    setCell(x + 23, y + 9);
-    setCell(x + 25, y + 9);
-    setCell(x + 26, y + 9);
+void
+Life::centreView()
+{
+    m_viewX = (m_engine->width() - (WIDTH / m_zoom)) / 2;
+    m_viewY = (m_engine->height() - (HEIGHT / m_zoom)) / 2;
+    m_panX = 0;
+    m_panY = 0;
+}
 
-    setCell(x + 21, y + 10);
-    setCell(x + 27, y + 10);
+//-------------------------------------------------------------------------
 
-    setCell(x + 21, y + 11);
-    setCell(x + 28, y + 11);
-    setCell(x + 31, y + 11);
-    setCell(x + 32, y + 11);
+void
+Life::moveView(
+    ogsfb32::Joystick& js)
+{
+    if (js.numberOfAxes() > 0)
+    {
+        const auto axes = js.getAxes(0);
 
-    setCell(x + 21, y + 12);
-    setCell(x + 22, y + 12);
-    setCell(x + 23, y + 12);
-    setCell(x + 27, y + 12);
-    setCell(x + 31, y + 12);
-    setCell(x + 32, y + 12);
+        m_panX += axes.x / panDivisor;
+        m_panY += axes.y / panDivisor;
 
-    setCell(x + 26, y + 13);
+        m_viewX += m_panX / m_zoom;
+        m_viewY += m_panY / m_zoom;
+        m_panX %= m_zoom;
+        m_panY %= m_zoom;
+    }
 
-    setCell(x + 20, y + 17);
-    setCell(x + 21, y + 17);
+    if (js.numberOfAxes() > 1)
+    {
+        const auto axes = js.getAxes(1);
 
-    setCell(x + 20, y + 18);
+        if (std::abs(axes.y) < (zoomThreshold / 2))
+        {
+            m_zooming = false;
+        }
+        else if ((std::abs(axes.y) >= zoomThreshold) and not m_zooming)
+        {
+            const int centreX = m_viewX + ((WIDTH / 2) / m_zoom);
+            const int centreY = m_viewY + ((HEIGHT / 2) / m_zoom);
 
-    setCell(x + 21, y + 19);
-    setCell(x + 22, y + 19);
-    setCell(x + 23, y + 19);
+            if (axes.y < 0)
+            {
+                m_zoom = std::min(m_zoom + 1, static_cast<int>(maxZoom));
+            }
+            else
+            {
+                m_zoom = std::max(m_zoom - 1, 1);
+            }
 
-    setCell(x + 23, y + 20);
+            m_viewX = centreX - ((WIDTH / 2) / m_zoom);
+            m_viewY = centreY - ((HEIGHT / 2) / m_zoom);
+            m_zooming = true;
+        }
+    }
+
+    const int width = m_engine->width();
+    const int height = m_engine->height();
 
-    m_cells = m_cellsNext;
+    m_viewX = ((m_viewX % width) + width) % width;
+    m_viewY = ((m_viewY % height) + height) % height;
 }
 
 //-------------------------------------------------------------------------
@@ -290,6 +301,8 @@ void
 Life::update(
     ogsfb32::Joystick& js)
 {
+    moveView(js);
+
     if (js.buttonPressed(Joystick::BUTTON_A))
     {
         if (m_display == DISPLAY_CELLS)
@@ -314,6 +327,14 @@ Life::update(
     {
         createSimkinGliderGun();
     }
+    else if (js.buttonPressed(Joystick::BUTTON_RIGHT_SHOULDER_OUTER))
+    {
+        loadPattern(1);
+    }
+    else if (js.buttonPressed(Joystick::BUTTON_LEFT_SHOULDER_OUTER))
+    {
+        loadPattern(-1);
+    }
     else
     {
         iterate();
@@ -326,24 +347,14 @@ void
 Life::draw(
     ogsfb32::FrameBuffer8880& fb)
 {
-    for (int32_t i = 0 ; i < HEIGHT * WIDTH ; ++i)
-    {
-        auto cell = m_cells[i];
-        auto neighbours = cell & ~aliveCellMask;
-        auto state = (cell & aliveCellMask) >> aliveCellShift;
-
-        ogsfb32::Image8880Point p{ int16_t(i % WIDTH), int16_t(i / WIDTH) };
-
-        if (m_display == DISPLAY_CELLS)
-        {
-            m_image.setPixel(p, m_cellColours[state]);
-        }
-        else
-        {
-            m_image.setPixel(p, m_populationColours[neighbours]);
-        }
-    }
-
-    fb.putImage(ogsfb32::FB8880Point(187, 0), m_image);
+    ProfileScope profileScope{"draw"};
+
+    m_renderer.draw(fb,
+                    (fb.getWidth() - WIDTH) / 2,
+                    *m_engine,
+                    m_viewX,
+                    m_viewY,
+                    m_zoom,
+                    m_palettes[m_display]);
 }
 
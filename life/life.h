@@ -31,11 +31,15 @@
 
 #include <array>
 #include <cstdint>
+#include <memory>
+#include <string>
 #include <vector>
 
 #include "framebuffer8880.h"
-#include "image8880.h"
 #include "joystick.h"
+#include "lifeEngine.h"
+#include "lifeRenderer.h"
+#include "periodDetector.h"
 
 //-------------------------------------------------------------------------
 
@@ -45,8 +49,6 @@ public:
 
     static constexpr int16_t WIDTH{480};
     static constexpr int16_t HEIGHT{480};
-    static constexpr size_t aliveCellShift{4};
-    static constexpr uint8_t aliveCellMask{1 << aliveCellShift};
 
     enum DisplayOption
     {
@@ -54,32 +56,55 @@ public:
         DISPLAY_POPULATION
     };
 
-    enum CellState
+    static constexpr int defaultTileUniverse{4096};
+    static constexpr int maxZoom{8};
+
+    enum EngineOption
     {
-        CELL_DEAD,
-        CELL_ALIVE
+        ENGINE_BYTE,
+        ENGINE_BIT,
+        ENGINE_TILE
     };
 
-    Life();
+    explicit Life(
+        EngineOption engine = ENGINE_BIT,
+        int threads = 1,
+        int universe = 0);
 
     void init();
+    void setPatterns(const std::vector<std::string>& patterns);
     void update(ogsfb32::Joystick& js);
     void draw(ogsfb32::FrameBuffer8880& fb);
 
+    void enableStatistics(bool enable) { m_engine->enableStatistics(enable); }
+    const LifeStatistics& statistics() const { return m_engine->statistics(); }
+    int period() const { return m_periodDetector.period(); }
+
 private:
 
-    void updateCell(int col, int row, int value);
-    void setCell( int col, int row);
-    void clearCell(int col, int row);
     void createGosperGliderGun();
     void createSimkinGliderGun();
+    void loadPattern(int step);
     void iterate();
+    void centreView();
+    void moveView(ogsfb32::Joystick& js);
 
     DisplayOption m_display;
     std::array<uint32_t, 9> m_populationColours;
     std::array<uint32_t, 2> m_cellColours;
-    std::array<uint8_t, WIDTH * HEIGHT> m_cells;
-    std::array<uint8_t, WIDTH * HEIGHT> m_cellsNext;
-    ogsfb32::Image8880 m_image;
+    std::unique_ptr<LifeEngine> m_engine;
+    PeriodDetector m_periodDetector;
+    std::array<LifeRenderer::Palette, 2> m_palettes;
+    LifeRenderer m_renderer;
+
+    int m_viewX;
+    int m_viewY;
+    int m_zoom;
+    int m_panX;
+    int m_panY;
+    bool m_zooming;
+
+    std::vector<std::string> m_patterns;
+    int m_pattern;
 };
 
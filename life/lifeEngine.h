@@ -0,0 +1,86 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <cstddef>
+#include <cstdint>
+
+//-------------------------------------------------------------------------
+
+// Kept up to date by the engine as it iterates. The hash is the sum of a
+// hash of each part of the grid, so it can be updated incrementally, and
+// is equal for equal grids.
+
+struct LifeStatistics
+{
+    uint64_t generation;
+    int64_t population;
+    int64_t births;
+    int64_t deaths;
+    uint64_t hash;
+};
+
+//-------------------------------------------------------------------------
+
+class LifeEngine
+{
+public:
+
+    static constexpr size_t aliveCellShift{4};
+    static constexpr uint8_t aliveCellMask{1 << aliveCellShift};
+
+    virtual ~LifeEngine() = default;
+
+    virtual int width() const = 0;
+    virtual int height() const = 0;
+
+    virtual void clear() = 0;
+    virtual void setCell(int col, int row) = 0;
+    virtual void iterate() = 0;
+
+    // Engines for which keeping statistics is costly only keep the
+    // generation count unless statistics are enabled.
+
+    virtual void enableStatistics(bool) {}
+    virtual const LifeStatistics& statistics() const = 0;
+
+    // Fill codes with the state of count cells running down from
+    // (col, row), wrapping at the edges. Each cell is encoded as
+    // (alive << aliveCellShift) | neighbours.
+
+    virtual void
+    getColumn(
+        int col,
+        int row,
+        int count,
+        uint8_t* codes) const = 0;
+};
+
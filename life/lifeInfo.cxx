@@ -0,0 +1,116 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <cinttypes>
+
+#include "lifeInfo.h"
+#include "profiler.h"
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+
+constexpr int lines{4};
+constexpr uint64_t nanosecondsPerSecond{1000000000};
+
+}
+
+//-------------------------------------------------------------------------
+
+LifeInfo::LifeInfo(
+    int16_t width,
+    int16_t yPosition,
+    const Life& life)
+:
+    Panel{width, lines * ogsfb32::sc_fontHeight, yPosition},
+    m_life(life),
+    m_heading(255, 255, 0),
+    m_foreground(255, 255, 255),
+    m_background(0, 0, 0),
+    m_rateStart{ogsfb32::Profiler::now()},
+    m_rateGeneration{0},
+    m_generationsPerSecond{0}
+{
+}
+
+//-------------------------------------------------------------------------
+
+void
+LifeInfo::drawLine(
+    ogsfb32::FontPoint& position,
+    std::string_view heading,
+    std::string_view value)
+{
+    const int16_t y = position.y();
+
+    position = drawString(position, heading, m_heading, getImage());
+    drawString(position, value, m_foreground, getImage());
+
+    position.set(0, y + ogsfb32::sc_fontHeight);
+}
+
+//-------------------------------------------------------------------------
+
+void
+LifeInfo::update(
+    time_t)
+{
+    const auto& statistics = m_life.statistics();
+    const auto now = ogsfb32::Profiler::now();
+
+    if (statistics.generation < m_rateGeneration)
+    {
+        m_rateStart = now;
+        m_rateGeneration = statistics.generation;
+    }
+    else if ((now - m_rateStart) >= nanosecondsPerSecond)
+    {
+        const uint64_t generations = statistics.generation - m_rateGeneration;
+
+        m_generationsPerSecond = (generations * nanosecondsPerSecond) / (now - m_rateStart);
+        m_rateStart = now;
+        m_rateGeneration = statistics.generation;
+    }
+
+    //---------------------------------------------------------------------
+
+    getImage().clear(m_background);
+    getArena().reset();
+
+    auto& arena = getArena();
+    const int period = m_life.period();
+
+    ogsfb32::FontPoint position = { 0, 0 };
+
+    drawLine(position, "generation ", arena.format("%" PRIu64, statistics.generation));
+    drawLine(position, "population ", arena.format("%" PRId64, statistics.population));
+    drawLine(position, "gen/s      ", arena.format("%d", m_generationsPerSecond));
+    drawLine(position, "period     ", (period > 0) ? arena.format("%d", period) : "-");
+}
+
@@ -0,0 +1,76 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <cstdint>
+#include <string_view>
+
+#include <sys/time.h>
+
+#include "image8880Font.h"
+#include "life.h"
+#include "panel.h"
+#include "rgb8880.h"
+
+//-------------------------------------------------------------------------
+
+// The generation, population, generations per second and period of the
+// pattern, if it has settled into a cycle.
+
+class LifeInfo
+:
+    public Panel
+{
+public:
+
+    LifeInfo(int16_t width, int16_t yPosition, const Life& life);
+
+    void update(time_t now) override;
+
+private:
+
+    void
+    drawLine(
+        ogsfb32::FontPoint& position,
+        std::string_view heading,
+        std::string_view value);
+
+    const Life& m_life;
+
+    ogsfb32::RGB8880 m_heading;
+    ogsfb32::RGB8880 m_foreground;
+    ogsfb32::RGB8880 m_background;
+
+    uint64_t m_rateStart;
+    uint64_t m_rateGeneration;
+    int m_generationsPerSecond;
+};
+
@@ -0,0 +1,182 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include <cstring>
+
+#include "image8880Transform.h"
+#include "lifeRenderer.h"
+
+//-------------------------------------------------------------------------
+
+LifeRenderer::LifeRenderer(
+    int width,
+    int height)
+:
+    m_width{width},
+    m_height{height},
+    m_x{0},
+    m_screenWidth{0},
+    m_viewX{0},
+    m_viewY{0},
+    m_zoom{0},
+    m_palette{},
+    m_valid{false},
+    m_column(height),
+    m_codes(width * height)
+{
+}
+
+//-------------------------------------------------------------------------
+
+void
+LifeRenderer::draw(
+    ogsfb32::FrameBuffer8880& fb,
+    int32_t x,
+    const LifeEngine& engine,
+    int viewX,
+    int viewY,
+    int zoom,
+    const Palette& palette)
+{
+    // Moving the board or changing the screen changes which columns are
+    // clipped, so everything is drawn again.
+
+    const bool redraw = not m_valid or
+                        (x != m_x) or
+                        (fb.getWidth() != m_screenWidth) or
+                        (viewX != m_viewX) or
+                        (viewY != m_viewY) or
+                        (zoom != m_zoom) or
+                        (palette != m_palette);
+
+    m_x = x;
+    m_screenWidth = fb.getWidth();
+    m_viewX = viewX;
+    m_viewY = viewY;
+    m_zoom = zoom;
+    m_palette = palette;
+    m_valid = true;
+
+    const int height = std::min<int>(m_height, fb.getHeight());
+    const int cols = (m_width + zoom - 1) / zoom;
+    const int rows = (height + zoom - 1) / zoom;
+
+    // The changed pixels are bounded by one damaged area.
+
+    int left = m_width;
+    int right = 0;
+    int top = height;
+    int bottom = 0;
+
+    for (int col = 0 ; col < cols ; ++col)
+    {
+        uint8_t* codes = m_codes.data() + (col * rows);
+        const uint8_t* column = m_column.data();
+
+        engine.getColumn(viewX + col, viewY, rows, m_column.data());
+
+        int first = 0;
+        int last = rows;
+
+        if (not redraw)
+        {
+            first = std::mismatch(column, column + rows, codes).first - column;
+
+            if (first == rows)
+            {
+                continue;
+            }
+
+            while (column[last - 1] == codes[last - 1])
+            {
+                --last;
+            }
+        }
+
+        const int x0 = col * zoom;
+        const int width = std::min(zoom, m_width - x0);
+
+        // The cell is expanded into the first of its pixel columns that is
+        // on the screen, then copied into the rest of them. A cell that is
+        // wholly off the screen is not drawn, so its codes are left as they
+        // were and it is drawn once it comes back.
+
+        int i = 0;
+        uint32_t* pixels = nullptr;
+
+        while ((pixels == nullptr) and (i < width))
+        {
+            pixels = fb.getColumn(x + x0 + i);
+            ++i;
+        }
+
+        if (pixels == nullptr)
+        {
+            continue;
+        }
+
+        std::copy(column + first, column + last, codes + first);
+
+        //-----------------------------------------------------------------
+
+        const int start = first * zoom;
+        const int end = std::min(last * zoom, height);
+
+        left = std::min(left, x0);
+        right = std::max(right, x0 + width);
+        top = std::min(top, start);
+        bottom = std::max(bottom, end);
+
+        ogsfb32::expandPalette(column + first,
+                               palette.data(),
+                               pixels + start,
+                               end - start,
+                               zoom);
+
+        for ( ; i < width ; ++i)
+        {
+            uint32_t* copy = fb.getColumn(x + x0 + i);
+
+            if (copy != nullptr)
+            {
+                std::memcpy(copy + start,
+                            pixels + start,
+                            (end - start) * sizeof(uint32_t));
+            }
+        }
+    }
+
+    if ((left < right) and (top < bottom))
+    {
+        fb.addDamage(ogsfb32::FB8880Point{ x + left, top },
+                     right - left,
+                     bottom - top);
+    }
+}
+
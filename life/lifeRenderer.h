@@ -0,0 +1,82 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "framebuffer8880.h"
+#include "lifeEngine.h"
+
+//-------------------------------------------------------------------------
+
+// Draws a view of the engine straight into the frame buffer. Each column
+// of cells maps to frame buffer lines, so pixels are written in memory
+// order through a colour lookup table indexed by the cell code. The codes
+// drawn last frame are kept, and only the changed span of each column is
+// redrawn.
+
+class LifeRenderer
+{
+public:
+
+    using Palette = std::array<uint32_t, 2 * LifeEngine::aliveCellMask>;
+
+    LifeRenderer(int width, int height);
+
+    void
+    draw(
+        ogsfb32::FrameBuffer8880& fb,
+        int32_t x,
+        const LifeEngine& engine,
+        int viewX,
+        int viewY,
+        int zoom,
+        const Palette& palette);
+
+private:
+
+    int m_width;
+    int m_height;
+
+    int32_t m_x;
+    int32_t m_screenWidth;
+    int m_viewX;
+    int m_viewY;
+    int m_zoom;
+    Palette m_palette;
+    bool m_valid;
+
+    std::vector<uint8_t> m_column;
+    std::vector<uint8_t> m_codes;
+};
+
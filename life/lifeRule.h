@@ -0,0 +1,99 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <cstdint>
+
+//-------------------------------------------------------------------------
+
+// Apply the Life rule to 64 cells at once. Each argument holds the cells
+// of one neighbour position (west, centre or east of the row above, the
+// same row and the row below) lined up with the cells being computed.
+
+inline uint64_t
+lifeRule(
+    uint64_t aw,
+    uint64_t ac,
+    uint64_t ae,
+    uint64_t mw,
+    uint64_t mc,
+    uint64_t me,
+    uint64_t bw,
+    uint64_t bc,
+    uint64_t be)
+{
+    // Sum each row of neighbours into a two bit number.
+
+    const uint64_t aOnes = aw ^ ac ^ ae;
+    const uint64_t aTwos = (aw & ac) | (ae & (aw ^ ac));
+    const uint64_t mOnes = mw ^ me;
+    const uint64_t mTwos = mw & me;
+    const uint64_t bOnes = bw ^ bc ^ be;
+    const uint64_t bTwos = (bw & bc) | (be & (bw ^ bc));
+
+    // Add the three sums. A cell lives next generation if the count is
+    // three, or two and it is alive, i.e. the ones bit is (set or alive)
+    // and exactly one of the twos is set.
+
+    const uint64_t ones = aOnes ^ mOnes ^ bOnes;
+    const uint64_t carry = (aOnes & mOnes) | (bOnes & (aOnes ^ mOnes));
+
+    const uint64_t p = aTwos ^ mTwos;
+    const uint64_t q = bTwos ^ carry;
+    const uint64_t twosParity = p ^ q;
+    const uint64_t twosMany = (aTwos & mTwos) | (bTwos & carry) | (p & q);
+
+    return twosParity & ~twosMany & (ones | mc);
+}
+
+//-------------------------------------------------------------------------
+
+// Hash a word of cells at a position in the grid for LifeStatistics.
+// Empty words hash to zero, so they need not be visited.
+
+inline uint64_t
+cellsHash(
+    uint64_t cells,
+    uint64_t index)
+{
+    if (cells == 0)
+    {
+        return 0;
+    }
+
+    uint64_t hash = cells ^ (index * 0x9E3779B97F4A7C15);
+
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EB;
+
+    return hash ^ (hash >> 31);
+}
+
@@ -0,0 +1,102 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include <limits>
+
+#include "lifeTrace.h"
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+
+//-------------------------------------------------------------------------
+
+int16_t
+traceValue(
+    int64_t value)
+{
+    return static_cast<int16_t>(
+        std::min<int64_t>(value, std::numeric_limits<int16_t>::max()));
+}
+
+//-------------------------------------------------------------------------
+
+}
+
+//-------------------------------------------------------------------------
+
+LifeTrace::LifeTrace(
+    int16_t width,
+    int16_t traceHeight,
+    int16_t yPosition,
+    const Life& life,
+    Values values,
+    int16_t gridHeight)
+:
+    TraceGraph(
+        width,
+        traceHeight,
+        0,
+        yPosition,
+        gridHeight,
+        (values == VALUES_POPULATION) ? 1 : 2,
+        "",
+        (values == VALUES_POPULATION)
+            ? std::vector<std::string>{"population"}
+            : std::vector<std::string>{"births", "deaths"},
+        (values == VALUES_POPULATION)
+            ? std::vector<ogsfb32::RGB8880>{{255, 255, 255}}
+            : std::vector<ogsfb32::RGB8880>{{27, 158, 119}, {217, 95, 2}}),
+    m_life(life),
+    m_values{values}
+{
+}
+
+//-------------------------------------------------------------------------
+
+void
+LifeTrace::update(
+    time_t)
+{
+    const auto& statistics = m_life.statistics();
+
+    if (m_values == VALUES_POPULATION)
+    {
+        Trace::addData({traceValue(statistics.population)},
+                       statistics.generation);
+    }
+    else
+    {
+        Trace::addData({traceValue(statistics.births),
+                        traceValue(statistics.deaths)},
+                       statistics.generation);
+    }
+}
+
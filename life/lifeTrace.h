@@ -0,0 +1,73 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <cstdint>
+
+#include <sys/time.h>
+
+#include "life.h"
+#include "traceGraph.h"
+
+//-------------------------------------------------------------------------
+
+// A graph of the population, or of the births and deaths, in each of the
+// most recent generations. There is a vertical grid line every 60
+// generations.
+
+class LifeTrace
+:
+    public TraceGraph
+{
+public:
+
+    enum Values
+    {
+        VALUES_POPULATION,
+        VALUES_CHANGES
+    };
+
+    LifeTrace(
+        int16_t width,
+        int16_t traceHeight,
+        int16_t yPosition,
+        const Life& life,
+        Values values,
+        int16_t gridHeight = 20);
+
+    void update(time_t now) override;
+
+private:
+
+    const Life& m_life;
+    Values m_values;
+};
+
@@ -28,12 +28,27 @@
 #include <getopt.h>
 #include <libgen.h>
 
+#include <algorithm>
 #include <csignal>
+#include <cstdio>
+#include <cstdlib>
 #include <iostream>
+#include <memory>
+#include <vector>
 
+#include "allocationCounter.h"
+#include "eventLoop.h"
 #include "framebuffer8880.h"
+#include "frameRecorder.h"
+#include "image8880.h"
+#include "image8880File.h"
 #include "joystick.h"
+#include "profiler.h"
+#include "profileTrace.h"
 #include "life.h"
+#include "lifeInfo.h"
+#include "lifeTrace.h"
+#include "patternLoader.h"
 
 //-------------------------------------------------------------------------
 
@@ -43,8 +58,42 @@ using namespace ogsfb32;
 
 namespace
 {
-volatile static std::sig_atomic_t run = 1;
 const char* defaultDevice = "/dev/dri/card0";
+
+//-------------------------------------------------------------------------
+
+// Parses <width>x<height>, followed by @<refresh> if refresh isn't null.
+
+bool
+parseSize(
+    const char* text,
+    int32_t& width,
+    int32_t& height,
+    uint32_t* refresh)
+{
+    unsigned w = 0;
+    unsigned h = 0;
+    unsigned r = 0;
+    char end = '\0';
+
+    const int count = std::sscanf(text, "%ux%u@%u%c", &w, &h, &r, &end);
+
+    if ((count < 2) or (count > 3) or ((count == 3) and (refresh == nullptr)))
+    {
+        return false;
+    }
+
+    width = w;
+    height = h;
+
+    if (refresh != nullptr)
+    {
+        *refresh = r;
+    }
+
+    return (w > 0) and (h > 0);
+}
+
 }
 
 //-------------------------------------------------------------------------
@@ -57,9 +106,34 @@ printUsage(
     os << "\n";
     os << "Usage: " << name << " <options>\n";
     os << "\n";
+    os << "    --allocations,-a - report frames that allocated memory";
+    os << " on exit\n";
+    os << "    --capture,-c <file> - save the screen to a PNG, or PPM if";
+    os << " it ends in .ppm, when the top left key is pressed\n";
     os << "    --device,-d - dri device to use";
     os << " (default is " << defaultDevice << ")\n";
+    os << "    --engine,-e <byte|bit|tile> - life engine to use";
+    os << " (default is bit)\n";
+    os << "    --filter,-f <nearest|bilinear> - filter used to scale";
+    os << " the render resolution (default is nearest)\n";
     os << "    --help,-h - print usage and exit\n";
+    os << "    --list-modes,-L - list the display modes and exit\n";
+    os << "    --mode,-m <width>x<height>[@<refresh>] - display mode to use\n";
+    os << "    --patterns,-P <directory> - pattern files to cycle through\n";
+    os << "    --profile,-p - show frame profile overlay\n";
+    os << "    --record,-R <file> - record the frames to a Y4M video file\n";
+    os << "    --render,-r <width>x<height> - draw at a lower resolution";
+    os << " and scale it to the screen\n";
+    os << "    --shadow,-S - draw into a copy of the screen";
+    os << " in cached memory\n";
+    os << "    --statistics,-s - show generation statistics";
+    os << " beside the board\n";
+    os << "    --threads,-n <count> - threads used by the bit engine";
+    os << " (default is 1)\n";
+    os << "    --trace,-t <file> - write Chrome trace events to file on exit\n";
+    os << "    --universe,-u <cells> - width and height of the universe";
+    os << " (default is 480, or " << Life::defaultTileUniverse;
+    os << " for the tile engine)\n";
     os << "\n";
 }
 
@@ -72,14 +146,41 @@ main(
 {
     const char* device = defaultDevice;
     char* program = basename(argv[0]);
+    Life::EngineOption engine = Life::ENGINE_BIT;
+    int threads = 1;
+    int universe = 0;
+    bool profile = false;
+    bool statistics = false;
+    const char* traceFile = nullptr;
+    const char* patternDirectory = nullptr;
+    bool listModes = false;
+    const char* captureFile = nullptr;
+    const char* recordFile = nullptr;
+    bool checkAllocations = false;
+    FrameBuffer8880::Options fbOptions;
 
     //---------------------------------------------------------------------
 
-    static const char* sopts = "d:h";
+    static const char* sopts = "ac:d:e:f:hLm:n:P:pR:r:Sst:u:";
     static struct option lopts[] = 
     {
+        { "allocations", no_argument, nullptr, 'a' },
+        { "capture", required_argument, nullptr, 'c' },
         { "device", required_argument, nullptr, 'd' },
+        { "engine", required_argument, nullptr, 'e' },
+        { "filter", required_argument, nullptr, 'f' },
         { "help", no_argument, nullptr, 'h' },
+        { "list-modes", no_argument, nullptr, 'L' },
+        { "mode", required_argument, nullptr, 'm' },
+        { "patterns", required_argument, nullptr, 'P' },
+        { "profile", no_argument, nullptr, 'p' },
+        { "record", required_argument, nullptr, 'R' },
+        { "render", required_argument, nullptr, 'r' },
+        { "shadow", no_argument, nullptr, 'S' },
+        { "statistics", no_argument, nullptr, 's' },
+        { "threads", required_argument, nullptr, 'n' },
+        { "trace", required_argument, nullptr, 't' },
+        { "universe", required_argument, nullptr, 'u' },
         { nullptr, no_argument, nullptr, 0 }
     };
 
@@ -89,12 +190,64 @@ main(
     {
         switch (opt)
         {
+        case 'a':
+
+            checkAllocations = true;
+
+            break;
+
+        case 'c':
+
+            captureFile = optarg;
+
+            break;
+
         case 'd':
 
             device = optarg;
 
             break;
 
+        case 'e':
+
+            if (std::string(optarg) == "byte")
+            {
+                engine = Life::ENGINE_BYTE;
+            }
+            else if (std::string(optarg) == "bit")
+            {
+                engine = Life::ENGINE_BIT;
+            }
+            else if (std::string(optarg) == "tile")
+            {
+                engine = Life::ENGINE_TILE;
+            }
+            else
+            {
+                printUsage(std::cerr, program);
+                ::exit(EXIT_FAILURE);
+            }
+
+            break;
+
+        case 'f':
+
+            if (std::string(optarg) == "nearest")
+            {
+                fbOptions.filter = Scaler::NEAREST;
+            }
+            else if (std::string(optarg) == "bilinear")
+            {
+                fbOptions.filter = Scaler::BILINEAR;
+            }
+            else
+            {
+                printUsage(std::cerr, program);
+                ::exit(EXIT_FAILURE);
+            }
+
+            break;
+
         case 'h':
 
             printUsage(std::cout, program);
@@ -102,6 +255,86 @@ main(
 
             break;
 
+        case 'L':
+
+            listModes = true;
+
+            break;
+
+        case 'm':
+
+            if (not parseSize(optarg,
+                              fbOptions.width,
+                              fbOptions.height,
+                              &fbOptions.refresh))
+            {
+                printUsage(std::cerr, program);
+                ::exit(EXIT_FAILURE);
+            }
+
+            break;
+
+        case 'n':
+
+            threads = std::max(1, std::atoi(optarg));
+
+            break;
+
+        case 'P':
+
+            patternDirectory = optarg;
+
+            break;
+
+        case 'p':
+
+            profile = true;
+
+            break;
+
+        case 'R':
+
+            recordFile = optarg;
+
+            break;
+
+        case 'r':
+
+            if (not parseSize(optarg,
+                              fbOptions.renderWidth,
+                              fbOptions.renderHeight,
+                              nullptr))
+            {
+                printUsage(std::cerr, program);
+                ::exit(EXIT_FAILURE);
+            }
+
+            break;
+
+        case 'S':
+
+            fbOptions.shadow = true;
+
+            break;
+
+        case 's':
+
+            statistics = true;
+
+            break;
+
+        case 't':
+
+            traceFile = optarg;
+
+            break;
+
+        case 'u':
+
+            universe = std::max(3, std::atoi(optarg));
+
+            break;
+
         default:
 
             printUsage(std::cerr, program);
@@ -115,32 +348,179 @@ main(
 
     try
     {
+        if (listModes)
+        {
+            for (const auto& mode : FrameBuffer8880::getModes(device))
+            {
+                std::cout << mode.width << "x" << mode.height
+                          << "@" << mode.refresh
+                          << ((mode.preferred) ? " (preferred)" : "")
+                          << "\n";
+            }
+
+            return 0;
+        }
+
         Joystick js;
-        FrameBuffer8880 fb(device);
+        FrameBuffer8880 fb(device, fbOptions);
         fb.clear(RGB8880{0, 0, 0});
 
-        Life life;
+        const FrameRecorder* recorder = nullptr;
+
+        if (recordFile != nullptr)
+        {
+            recorder = &fb.startRecording(recordFile);
+        }
+
+        std::unique_ptr<ProfileTrace> profileTrace;
+
+        if (profile or (traceFile != nullptr))
+        {
+            Profiler::enable();
+        }
+
+        if (profile)
+        {
+            constexpr int16_t traceHeight = 100;
+            constexpr int16_t width = 180;
+
+            profileTrace = std::make_unique<ProfileTrace>(
+                width,
+                traceHeight,
+                fb.getHeight() - traceHeight - Trace::getLegendHeight(),
+                50,
+                std::vector<std::string>{"iterate", "draw"},
+                std::vector<std::string>{"iter", "draw"});
+        }
+
+        Life life{engine, threads, universe};
+
+        if (patternDirectory != nullptr)
+        {
+            life.setPatterns(PatternLoader::list(patternDirectory));
+        }
+
         life.init();
+
+        std::vector<std::unique_ptr<Panel>> panels;
+
+        if (statistics)
+        {
+            life.enableStatistics(true);
+
+            constexpr int16_t traceHeight = 100;
+            constexpr int16_t width = 180;
+            constexpr int16_t gap = 4;
+
+            panels.push_back(
+                std::make_unique<LifeTrace>(width,
+                                            traceHeight,
+                                            0,
+                                            life,
+                                            LifeTrace::VALUES_POPULATION));
+
+            panels.push_back(
+                std::make_unique<LifeTrace>(width,
+                                            traceHeight,
+                                            panels.back()->getBottom() + gap,
+                                            life,
+                                            LifeTrace::VALUES_CHANGES));
+
+            panels.push_back(
+                std::make_unique<LifeInfo>(width,
+                                           panels.back()->getBottom() + gap,
+                                           life));
+
+            for (auto& panel : panels)
+            {
+                panel->setXPosition(fb.getWidth() - width);
+            }
+        }
+
         life.draw(fb);
 
         //-----------------------------------------------------------------
 
-        while (run)
+        EventLoop loop;
+
+        for (const int signalNumber : { SIGINT, SIGTERM })
         {
-            js.read();
+            loop.addSignal(signalNumber, [&loop] { loop.stop(); });
+        }
+
+        loop.addReader(js.fd(), [&js] { js.read(); });
+        loop.addReader(fb.getFd(), [&fb] { fb.handleEvents(); });
 
+        AllocationCounter allocations;
+
+        // Life steps the simulation as fast as it can, so it runs from the
+        // idle callback and the event loop never blocks.
+
+        loop.setIdle([&]
+        {
             if (js.buttonPressed(Joystick::BUTTON_TOP_RIGHT))
             {
-                run = 0;
+                loop.stop();
+                return false;
             }
-            else
+
+            if ((captureFile != nullptr) and
+                js.buttonPressed(Joystick::BUTTON_TOP_LEFT))
             {
-                life.update(js);
-                life.draw(fb);
+                writeImage(fb.capture(), captureFile);
             }
+
+            life.update(js);
+            life.draw(fb);
+
+            for (auto& panel : panels)
+            {
+                panel->update(0);
+                panel->show(fb);
+            }
+
+            if (profileTrace)
+            {
+                profileTrace->update(0);
+                profileTrace->show(fb);
+            }
+
+            fb.present();
+
+            if (checkAllocations)
+            {
+                allocations.endFrame();
+            }
+
+            return true;
+        });
+
+        loop.run();
+
+        if (checkAllocations)
+        {
+            std::cerr << allocations.getAllocatingFrames() << " of "
+                      << allocations.getFrames()
+                      << " frames allocated memory\n";
+        }
+
+        if (recorder != nullptr)
+        {
+            if (recorder->getDroppedFrames() > 0)
+            {
+                std::cerr << "dropped " << recorder->getDroppedFrames()
+                          << " frames while recording\n";
+            }
+
+            fb.stopRecording();
         }
 
         fb.clear();
+
+        if (traceFile != nullptr)
+        {
+            Profiler::writeChromeTrace(traceFile);
+        }
     }
     catch (std::exception& error)
     {
@@ -0,0 +1,358 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <dirent.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <system_error>
+
+#include "patternLoader.h"
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+
+//-------------------------------------------------------------------------
+
+class CellWriter
+{
+public:
+
+    CellWriter(
+        LifeEngine& engine,
+        int width,
+        int height)
+    :
+        m_engine(engine),
+        m_x{(engine.width() / 2) - (width / 2)},
+        m_y{(engine.height() / 2) - (height / 2)}
+    {
+    }
+
+    void
+    set(
+        int col,
+        int row)
+    {
+        const int w = m_engine.width();
+        const int h = m_engine.height();
+
+        m_engine.setCell((((m_x + col) % w) + w) % w,
+                         (((m_y + row) % h) + h) % h);
+    }
+
+private:
+
+    LifeEngine& m_engine;
+    int m_x;
+    int m_y;
+};
+
+//-------------------------------------------------------------------------
+
+bool
+endsWith(
+    const std::string& value,
+    const std::string& suffix)
+{
+    return (value.size() >= suffix.size()) and
+           std::equal(suffix.rbegin(), suffix.rend(), value.rbegin());
+}
+
+//-------------------------------------------------------------------------
+
+}
+
+//-------------------------------------------------------------------------
+
+PatternLoader::Format
+PatternLoader::formatOf(
+    const std::string& filename)
+{
+    if (endsWith(filename, ".rle"))
+    {
+        return FORMAT_RLE;
+    }
+    else if (endsWith(filename, ".cells"))
+    {
+        return FORMAT_CELLS;
+    }
+    else if (endsWith(filename, ".lif") or endsWith(filename, ".life"))
+    {
+        return FORMAT_LIFE_1_06;
+    }
+
+    return FORMAT_UNKNOWN;
+}
+
+//-------------------------------------------------------------------------
+
+std::vector<std::string>
+PatternLoader::list(
+    const std::string& directory)
+{
+    std::vector<std::string> filenames;
+
+    DIR* dir = ::opendir(directory.c_str());
+
+    if (dir == nullptr)
+    {
+        throw std::system_error{errno,
+                                std::system_category(),
+                                "cannot open pattern directory " + directory};
+    }
+
+    struct dirent* entry = nullptr;
+
+    while ((entry = ::readdir(dir)) != nullptr)
+    {
+        const std::string name{entry->d_name};
+
+        if (formatOf(name) != FORMAT_UNKNOWN)
+        {
+            filenames.push_back(directory + "/" + name);
+        }
+    }
+
+    ::closedir(dir);
+
+    std::sort(filenames.begin(), filenames.end());
+
+    return filenames;
+}
+
+//-------------------------------------------------------------------------
+
+void
+PatternLoader::load(
+    const std::string& filename,
+    LifeEngine& engine)
+{
+    std::ifstream ifs{filename};
+
+    if (not ifs)
+    {
+        throw std::system_error{errno,
+                                std::system_category(),
+                                "cannot open pattern file " + filename};
+    }
+
+    const Format format = formatOf(filename);
+
+    load(ifs, (format == FORMAT_UNKNOWN) ? FORMAT_RLE : format, engine);
+}
+
+//-------------------------------------------------------------------------
+
+void
+PatternLoader::load(
+    std::istream& is,
+    Format format,
+    LifeEngine& engine)
+{
+    engine.clear();
+
+    switch (format)
+    {
+    case FORMAT_CELLS:
+
+        loadCells(is, engine);
+
+        break;
+
+    case FORMAT_LIFE_1_06:
+
+        loadLife106(is, engine);
+
+        break;
+
+    case FORMAT_RLE:
+    default:
+
+        loadRle(is, engine);
+
+        break;
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+PatternLoader::loadRle(
+    std::istream& is,
+    LifeEngine& engine)
+{
+    std::string line;
+    int width = 0;
+    int height = 0;
+
+    while (std::getline(is, line))
+    {
+        if (not line.empty() and (line[0] != '#'))
+        {
+            if (std::sscanf(line.c_str(), " x = %d , y = %d", &width, &height) != 2)
+            {
+                throw std::runtime_error("RLE pattern has no header line");
+            }
+
+            break;
+        }
+    }
+
+    CellWriter cells{engine, width, height};
+
+    int col = 0;
+    int row = 0;
+    int count = 0;
+    char c;
+
+    while (is.get(c) and (c != '!'))
+    {
+        if (std::isdigit(static_cast<unsigned char>(c)))
+        {
+            count = (count * 10) + (c - '0');
+            continue;
+        }
+
+        const int run = (count == 0) ? 1 : count;
+        count = 0;
+
+        if (c == '$')
+        {
+            row += run;
+            col = 0;
+        }
+        else if ((c == 'b') or (c == '.'))
+        {
+            col += run;
+        }
+        else if (std::isalpha(static_cast<unsigned char>(c)))
+        {
+            for (int i = 0 ; i < run ; ++i)
+            {
+                cells.set(col++, row);
+            }
+        }
+        else if (not std::isspace(static_cast<unsigned char>(c)))
+        {
+            throw std::runtime_error(std::string("unexpected '") + c +
+                                     "' in RLE pattern");
+        }
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+PatternLoader::loadCells(
+    std::istream& is,
+    LifeEngine& engine)
+{
+    // The size is not stored in the file, so measure it first if the
+    // stream can be rewound.
+
+    std::string line;
+    int width = 0;
+    int height = 0;
+    const auto start = is.tellg();
+
+    if (start != std::istream::pos_type(-1))
+    {
+        while (std::getline(is, line))
+        {
+            if (line.empty() or (line[0] != '!'))
+            {
+                width = std::max(width, static_cast<int>(line.size()));
+                ++height;
+            }
+        }
+
+        is.clear();
+        is.seekg(start);
+    }
+
+    CellWriter cells{engine, width, height};
+
+    int row = 0;
+
+    while (std::getline(is, line))
+    {
+        if (not line.empty() and (line[0] == '!'))
+        {
+            continue;
+        }
+
+        for (int col = 0 ; col < static_cast<int>(line.size()) ; ++col)
+        {
+            if ((line[col] == 'O') or (line[col] == '*'))
+            {
+                cells.set(col, row);
+            }
+        }
+
+        ++row;
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+PatternLoader::loadLife106(
+    std::istream& is,
+    LifeEngine& engine)
+{
+    // Coordinates are relative to the centre of the universe.
+
+    CellWriter cells{engine, 0, 0};
+
+    std::string line;
+
+    while (std::getline(is, line))
+    {
+        int col = 0;
+        int row = 0;
+
+        if (line.empty() or (line[0] == '#'))
+        {
+            continue;
+        }
+        else if (std::sscanf(line.c_str(), "%d %d", &col, &row) != 2)
+        {
+            throw std::runtime_error("malformed Life 1.06 line: " + line);
+        }
+
+        cells.set(col, row);
+    }
+}
+
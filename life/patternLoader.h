@@ -0,0 +1,70 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <istream>
+#include <string>
+#include <vector>
+
+#include "lifeEngine.h"
+
+//-------------------------------------------------------------------------
+
+// Reads patterns in the RLE, plaintext (.cells) and Life 1.06 formats,
+// setting cells in the engine as they are decoded. Patterns are centred
+// in the universe and wrap at its edges.
+
+class PatternLoader
+{
+public:
+
+    enum Format
+    {
+        FORMAT_UNKNOWN,
+        FORMAT_RLE,
+        FORMAT_CELLS,
+        FORMAT_LIFE_1_06
+    };
+
+    static Format formatOf(const std::string& filename);
+
+    static std::vector<std::string> list(const std::string& directory);
+
+    static void load(const std::string& filename, LifeEngine& engine);
+    static void load(std::istream& is, Format format, LifeEngine& engine);
+
+private:
+
+    static void loadRle(std::istream& is, LifeEngine& engine);
+    static void loadCells(std::istream& is, LifeEngine& engine);
+    static void loadLife106(std::istream& is, LifeEngine& engine);
+};
+
@@ -0,0 +1,78 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <algorithm>
+
+#include "periodDetector.h"
+
+//-------------------------------------------------------------------------
+
+PeriodDetector::PeriodDetector(
+    int maxPeriod)
+:
+    m_hashes(maxPeriod),
+    m_generation{0},
+    m_count{0},
+    m_next{0},
+    m_period{0}
+{
+}
+
+//-------------------------------------------------------------------------
+
+int
+PeriodDetector::update(
+    const LifeStatistics& statistics)
+{
+    // The engine was cleared for a new pattern.
+
+    if (statistics.generation <= m_generation)
+    {
+        m_count = 0;
+    }
+
+    m_generation = statistics.generation;
+    m_period = 0;
+
+    const int size = static_cast<int>(m_hashes.size());
+
+    for (int period = 1 ; (period <= m_count) and (m_period == 0) ; ++period)
+    {
+        if (m_hashes[(m_next - period + size) % size] == statistics.hash)
+        {
+            m_period = period;
+        }
+    }
+
+    m_hashes[m_next] = statistics.hash;
+    m_next = (m_next + 1) % size;
+    m_count = std::min(m_count + 1, size);
+
+    return m_period;
+}
+
@@ -0,0 +1,362 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <algorithm>
+
+#include "lifeRule.h"
+#include "tileLifeEngine.h"
+
+//-------------------------------------------------------------------------
+
+const TileLifeEngine::Tile TileLifeEngine::sc_emptyTile{};
+
+//-------------------------------------------------------------------------
+
+TileLifeEngine::TileLifeEngine(
+    int width,
+    int height)
+:
+    m_tilesAcross{std::max(1, (width + tileSize - 1) / tileSize)},
+    m_tilesDown{std::max(1, (height + tileSize - 1) / tileSize)},
+    m_tiles(m_tilesAcross * m_tilesDown),
+    m_generation{0},
+    m_activeGeneration(m_tilesAcross * m_tilesDown, 0),
+    m_changed{},
+    m_active{},
+    m_next{},
+    m_statisticsEnabled{false},
+    m_statistics{}
+{
+}
+
+//-------------------------------------------------------------------------
+
+void
+TileLifeEngine::clear()
+{
+    for (auto& tile : m_tiles)
+    {
+        tile.reset();
+    }
+
+    m_changed.clear();
+    m_active.clear();
+    m_statistics = LifeStatistics{};
+}
+
+//-------------------------------------------------------------------------
+
+void
+TileLifeEngine::setCell(
+    int col,
+    int row)
+{
+    const int index = tileIndex(col / tileSize, row / tileSize);
+    auto& tile = m_tiles[index];
+
+    if (not tile)
+    {
+        tile = std::make_unique<Tile>();
+    }
+
+    uint64_t& cells = (*tile)[row % tileSize];
+    const uint64_t before = cells;
+
+    cells |= uint64_t{1} << (col % tileSize);
+
+    if (cells != before)
+    {
+        const uint64_t hashIndex = (uint64_t(index) * tileSize) + (row % tileSize);
+
+        ++m_statistics.population;
+        m_statistics.hash += cellsHash(cells, hashIndex) - cellsHash(before, hashIndex);
+    }
+
+    markChanged(index);
+}
+
+//-------------------------------------------------------------------------
+
+void
+TileLifeEngine::markChanged(
+    int index)
+{
+    if (m_changed.empty() or (m_changed.back() != index))
+    {
+        m_changed.push_back(index);
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+TileLifeEngine::stepTile(
+    int index,
+    Tile& next) const
+{
+    const int tileX = index % m_tilesAcross;
+    const int tileY = index / m_tilesAcross;
+
+    const Tile& north = tile(tileX, tileY - 1);
+    const Tile& northEast = tile(tileX + 1, tileY - 1);
+    const Tile& northWest = tile(tileX - 1, tileY - 1);
+    const Tile& centre = tile(tileX, tileY);
+    const Tile& east = tile(tileX + 1, tileY);
+    const Tile& west = tile(tileX - 1, tileY);
+    const Tile& south = tile(tileX, tileY + 1);
+    const Tile& southEast = tile(tileX + 1, tileY + 1);
+    const Tile& southWest = tile(tileX - 1, tileY + 1);
+
+    // Row -1 and row tileSize come from the tiles above and below.
+
+    auto cells = [&](int r, uint64_t& w, uint64_t& c, uint64_t& e)
+    {
+        uint64_t westWord;
+        uint64_t eastWord;
+
+        if (r < 0)
+        {
+            westWord = northWest[tileSize - 1];
+            c = north[tileSize - 1];
+            eastWord = northEast[tileSize - 1];
+        }
+        else if (r >= tileSize)
+        {
+            westWord = southWest[0];
+            c = south[0];
+            eastWord = southEast[0];
+        }
+        else
+        {
+            westWord = west[r];
+            c = centre[r];
+            eastWord = east[r];
+        }
+
+        w = (c << 1) | (westWord >> 63);
+        e = (c >> 1) | (eastWord << 63);
+    };
+
+    uint64_t aw, ac, ae;
+    uint64_t mw, mc, me;
+    uint64_t bw, bc, be;
+
+    cells(-1, aw, ac, ae);
+    cells(0, mw, mc, me);
+
+    for (int r = 0 ; r < tileSize ; ++r)
+    {
+        cells(r + 1, bw, bc, be);
+
+        next[r] = lifeRule(aw, ac, ae, mw, mc, me, bw, bc, be);
+
+        aw = mw; ac = mc; ae = me;
+        mw = bw; mc = bc; me = be;
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+TileLifeEngine::iterate()
+{
+    // Anything that changed last generation can only affect its own tile
+    // and the eight around it.
+
+    ++m_generation;
+    m_active.clear();
+
+    for (const int index : m_changed)
+    {
+        const int tileX = index % m_tilesAcross;
+        const int tileY = index / m_tilesAcross;
+
+        for (int dy = -1 ; dy <= 1 ; ++dy)
+        {
+            for (int dx = -1 ; dx <= 1 ; ++dx)
+            {
+                const int neighbour = tileIndex(tileX + dx, tileY + dy);
+
+                if (m_activeGeneration[neighbour] != m_generation)
+                {
+                    m_activeGeneration[neighbour] = m_generation;
+                    m_active.push_back(neighbour);
+                }
+            }
+        }
+    }
+
+    m_changed.clear();
+
+    if (m_next.size() < m_active.size())
+    {
+        m_next.resize(m_active.size());
+    }
+
+    for (size_t i = 0 ; i < m_active.size() ; ++i)
+    {
+        stepTile(m_active[i], m_next[i]);
+    }
+
+    int64_t births = 0;
+    int64_t deaths = 0;
+
+    for (size_t i = 0 ; i < m_active.size() ; ++i)
+    {
+        const int index = m_active[i];
+        auto& tile = m_tiles[index];
+        const Tile& current = (tile) ? *tile : sc_emptyTile;
+        const Tile& next = m_next[i];
+
+        if (next == current)
+        {
+            continue;
+        }
+
+        m_changed.push_back(index);
+
+        for (int r = 0 ; m_statisticsEnabled and (r < tileSize) ; ++r)
+        {
+            const uint64_t before = current[r];
+            const uint64_t after = next[r];
+
+            if (after != before)
+            {
+                const uint64_t hashIndex = (uint64_t(index) * tileSize) + r;
+
+                births += __builtin_popcountll(after & ~before);
+                deaths += __builtin_popcountll(before & ~after);
+                m_statistics.hash += cellsHash(after, hashIndex) - cellsHash(before, hashIndex);
+            }
+        }
+
+        if (next == sc_emptyTile)
+        {
+            tile.reset();
+        }
+        else if (tile)
+        {
+            *tile = next;
+        }
+        else
+        {
+            tile = std::make_unique<Tile>(next);
+        }
+    }
+
+    ++m_statistics.generation;
+    m_statistics.population += births - deaths;
+    m_statistics.births = births;
+    m_statistics.deaths = deaths;
+}
+
+//-------------------------------------------------------------------------
+
+void
+TileLifeEngine::enableStatistics(
+    bool enable)
+{
+    // The counts are not kept up to date while disabled, so recount.
+
+    if (enable and not m_statisticsEnabled)
+    {
+        m_statistics.population = 0;
+        m_statistics.births = 0;
+        m_statistics.deaths = 0;
+        m_statistics.hash = 0;
+
+        for (size_t index = 0 ; index < m_tiles.size() ; ++index)
+        {
+            if (m_tiles[index])
+            {
+                const Tile& tile = *m_tiles[index];
+
+                for (int r = 0 ; r < tileSize ; ++r)
+                {
+                    m_statistics.population += __builtin_popcountll(tile[r]);
+                    m_statistics.hash += cellsHash(tile[r], (index * tileSize) + r);
+                }
+            }
+        }
+    }
+
+    m_statisticsEnabled = enable;
+}
+
+//-------------------------------------------------------------------------
+
+int
+TileLifeEngine::alive(
+    int col,
+    int row) const
+{
+    const Tile& cells = tile(col / tileSize, row / tileSize);
+
+    return (cells[row % tileSize] >> (col % tileSize)) & 1;
+}
+
+//-------------------------------------------------------------------------
+
+void
+TileLifeEngine::getColumn(
+    int col,
+    int row,
+    int count,
+    uint8_t* codes) const
+{
+    const int w = width();
+    const int h = height();
+
+    col = ((col % w) + w) % w;
+    row = ((row % h) + h) % h;
+
+    const int left = (col == 0) ? w - 1 : col - 1;
+    const int right = (col == w - 1) ? 0 : col + 1;
+
+    auto columnSum = [&](int r)
+    {
+        return alive(left, r) + alive(col, r) + alive(right, r);
+    };
+
+    int previous = columnSum((row == 0) ? h - 1 : row - 1);
+    int current = columnSum(row);
+
+    for (int i = 0 ; i < count ; ++i)
+    {
+        const int below = (row == h - 1) ? 0 : row + 1;
+        const int next = columnSum(below);
+        const int self = alive(col, row);
+
+        codes[i] = (self << aliveCellShift) | (previous + current + next - self);
+
+        previous = current;
+        current = next;
+        row = below;
+    }
+}
+
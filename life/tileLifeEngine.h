@@ -0,0 +1,116 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "lifeEngine.h"
+
+//-------------------------------------------------------------------------
+
+// A sparse engine for universes much larger than the screen. The torus is
+// divided into 64x64 tiles of one word per row. Only tiles that changed in
+// the last generation, and their neighbours, are computed, so empty and
+// stable areas cost nothing. Empty tiles are not allocated.
+
+class TileLifeEngine
+:
+    public LifeEngine
+{
+public:
+
+    static constexpr int tileSize{64};
+
+    TileLifeEngine(int width, int height);
+
+    int width() const override { return m_tilesAcross * tileSize; }
+    int height() const override { return m_tilesDown * tileSize; }
+
+    void clear() override;
+    void setCell(int col, int row) override;
+    void iterate() override;
+
+    void enableStatistics(bool enable) override;
+    const LifeStatistics& statistics() const override { return m_statistics; }
+
+    void
+    getColumn(
+        int col,
+        int row,
+        int count,
+        uint8_t* codes) const override;
+
+    int activeTiles() const { return static_cast<int>(m_active.size()); }
+
+private:
+
+    using Tile = std::array<uint64_t, tileSize>;
+
+    int
+    tileIndex(int tileX, int tileY) const
+    {
+        tileX = (tileX + m_tilesAcross) % m_tilesAcross;
+        tileY = (tileY + m_tilesDown) % m_tilesDown;
+
+        return tileX + (tileY * m_tilesAcross);
+    }
+
+    const Tile&
+    tile(int tileX, int tileY) const
+    {
+        const auto& tile = m_tiles[tileIndex(tileX, tileY)];
+
+        return (tile) ? *tile : sc_emptyTile;
+    }
+
+    int alive(int col, int row) const;
+    void markChanged(int index);
+    void stepTile(int index, Tile& next) const;
+
+    static const Tile sc_emptyTile;
+
+    int m_tilesAcross;
+    int m_tilesDown;
+    std::vector<std::unique_ptr<Tile>> m_tiles;
+
+    uint32_t m_generation;
+    std::vector<uint32_t> m_activeGeneration;
+    std::vector<int> m_changed;
+    std::vector<int> m_active;
+    std::vector<Tile> m_next;
+
+    bool m_statisticsEnabled;
+    LifeStatistics m_statistics;
+};
+
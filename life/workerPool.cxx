@@ -0,0 +1,161 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include "workerPool.h"
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+
+// A generation of a 480x480 board takes well under a millisecond, so spin
+// for a short while before sleeping to avoid a wakeup on every generation.
+
+constexpr int spinCount{20000};
+
+}
+
+//-------------------------------------------------------------------------
+
+WorkerPool::WorkerPool(
+    int workers)
+:
+    m_threads(),
+    m_mutex(),
+    m_start(),
+    m_done(),
+    m_task{nullptr},
+    m_generation{0},
+    m_remaining{0},
+    m_stop{false}
+{
+    for (int i = 1 ; i < workers ; ++i)
+    {
+        m_threads.emplace_back(&WorkerPool::worker, this, i);
+    }
+}
+
+//-------------------------------------------------------------------------
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop.store(true, std::memory_order_relaxed);
+        m_generation.fetch_add(1, std::memory_order_release);
+    }
+
+    m_start.notify_all();
+
+    for (auto& thread : m_threads)
+    {
+        thread.join();
+    }
+}
+
+//-------------------------------------------------------------------------
+
+void
+WorkerPool::run(
+    const Task& task)
+{
+    if (m_threads.empty())
+    {
+        task(0);
+        return;
+    }
+
+    m_task = &task;
+    m_remaining.store(static_cast<int>(m_threads.size()), std::memory_order_relaxed);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_generation.fetch_add(1, std::memory_order_release);
+    }
+
+    m_start.notify_all();
+
+    task(0);
+
+    for (int i = 0 ; i < spinCount ; ++i)
+    {
+        if (m_remaining.load(std::memory_order_acquire) == 0)
+        {
+            return;
+        }
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [this]
+    {
+        return m_remaining.load(std::memory_order_acquire) == 0;
+    });
+}
+
+//-------------------------------------------------------------------------
+
+void
+WorkerPool::worker(
+    int index)
+{
+    uint64_t seen{0};
+
+    while (true)
+    {
+        bool started = false;
+
+        for (int i = 0 ; (i < spinCount) and not started ; ++i)
+        {
+            started = (m_generation.load(std::memory_order_acquire) != seen);
+        }
+
+        if (not started)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_start.wait(lock, [this, seen]
+            {
+                return m_generation.load(std::memory_order_acquire) != seen;
+            });
+        }
+
+        seen = m_generation.load(std::memory_order_acquire);
+
+        if (m_stop.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        (*m_task)(index);
+
+        if (m_remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_done.notify_one();
+        }
+    }
+}
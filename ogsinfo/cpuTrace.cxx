@@ -25,49 +25,66 @@
 //
 //-------------------------------------------------------------------------
 
+#include <cinttypes>
 #include <cstdint>
-#include <fstream>
+#include <cstdio>
 #include <stdexcept>
 #include <system_error>
 
 #include <unistd.h>
 
 #include "cpuTrace.h"
+#include "frameArena.h"
+#include "system.h"
 
 //-------------------------------------------------------------------------
 
 CpuStats::
-CpuStats()
+CpuStats(
+    ogsfb32::FrameArena& arena)
+:
+    m_user{0},
+    m_nice{0},
+    m_system{0},
+    m_idle{0},
+    m_iowait{0},
+    m_irq{0},
+    m_softirq{0},
+    m_steal{0},
+    m_guest{0},
+    m_guest_nice{0}
 {
-    std::ifstream ifs{"/proc/stat", std::ifstream::in};
+    // Only the first line, the total for all the CPUs, is needed.
+
+    const char* stat = ogsinf::readFile("/proc/stat", arena, 256);
 
-    if (ifs.is_open() == false)
+    if (stat == nullptr)
     {
         throw std::system_error{errno,
                                 std::system_category(),
                                 "unable to open /proc/stat"};
     }
 
-    std::string id;
-    ifs >> id;
-
-    if (id != "cpu")
+    const int fields = std::sscanf(stat,
+                                   "cpu %" SCNu32 " %" SCNu32 " %" SCNu32
+                                   " %" SCNu32 " %" SCNu32 " %" SCNu32
+                                   " %" SCNu32 " %" SCNu32 " %" SCNu32
+                                   " %" SCNu32,
+                                   &m_user,
+                                   &m_nice,
+                                   &m_system,
+                                   &m_idle,
+                                   &m_iowait,
+                                   &m_irq,
+                                   &m_softirq,
+                                   &m_steal,
+                                   &m_guest,
+                                   &m_guest_nice);
+
+    if (fields < 1)
     {
-        throw std::logic_error{
-            "reading /proc/stat expected \"cpu\", but found " + id};
+        throw std::logic_error{"reading /proc/stat expected \"cpu\""};
     }
-
-    ifs
-        >> m_user
-        >> m_nice
-        >> m_system
-        >> m_idle
-        >> m_iowait
-        >> m_irq
-        >> m_softirq
-        >> m_steal
-        >> m_guest
-        >> m_guest_nice;
 }
 
 //-------------------------------------------------------------------------
@@ -140,7 +157,7 @@ CpuTrace(
         std::vector<ogsfb32::RGB8880>{{4, 90, 141},
                                        {116, 169, 207},
                                        {241, 238, 246}}),
-    m_previousStats{}
+    m_previousStats{getArena()}
 {
 }
 
@@ -151,7 +168,9 @@ CpuTrace::
 update(
     time_t now)
 {
-    CpuStats currentStats;
+    getArena().reset();
+
+    CpuStats currentStats{getArena()};
 
     CpuStats diff{currentStats - m_previousStats};
 
@@ -161,7 +180,7 @@ update(
     int16_t nice = (diff.nice() * m_traceScale) / totalCpu;
     int16_t system = (diff.system() * m_traceScale) / totalCpu;
 
-    Trace::addData(std::vector<int16_t>{user, nice, system}, now);
+    Trace::addData({user, nice, system}, now);
 
     m_previousStats = currentStats;
 }
@@ -40,6 +40,7 @@
 
 namespace ogsfb32
 {
+class FrameArena;
 class FrameBuffer8880;
 }
 
@@ -49,7 +50,7 @@ class CpuStats
 {
 public:
 
-    CpuStats();
+    explicit CpuStats(ogsfb32::FrameArena& arena);
 
     uint32_t total() const;
     uint32_t user() const { return m_user; }
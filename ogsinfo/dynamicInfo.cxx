@@ -27,60 +27,74 @@
 
 #include <cmath>
 #include <cstdint>
-#include <iomanip>
-#include <regex>
-#include <sstream>
+#include <cstring>
+#include <ctime>
 #include <stdexcept>
-#include <string>
 
-#include <ifaddrs.h>
 #include <unistd.h>
 
 #include <arpa/inet.h>
+#include <net/if.h>
 #include <netinet/in.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
 #include <sys/types.h>
 
 #include "dynamicInfo.h"
+#include "fileDescriptor.h"
+#include "frameArena.h"
 #include "system.h"
 
 //-------------------------------------------------------------------------
 
-std::string
+std::string_view
 DynamicInfo::
 getIpAddress(
     char& interface)
 {
-    struct ifaddrs *ifaddr = nullptr;
-    struct ifaddrs *ifa = nullptr;
     interface = 'X';
 
-    std::string address = "   .   .   .   ";
+    // SIOCGIFCONF fills in a buffer we give it, where getifaddrs would
+    // allocate a list on every update.
 
-    ::getifaddrs(&ifaddr);
+    ogsfb32::FileDescriptor fd{::socket(AF_INET, SOCK_DGRAM, 0)};
 
-    for (ifa = ifaddr ; ifa != nullptr ; ifa = ifa->ifa_next)
+    if (fd.fd() == -1)
     {
-        if (ifa ->ifa_addr->sa_family == AF_INET)
-        {
-            void *addr = &((struct sockaddr_in *)ifa->ifa_addr)->sin_addr;
-
-            if (strcmp(ifa->ifa_name, "lo") != 0)
-            {
-                char buffer[INET_ADDRSTRLEN];
-                ::inet_ntop(AF_INET, addr, buffer, sizeof(buffer));
-                address = buffer;
-                interface = ifa->ifa_name[0];
-                break;
-            }
-        }
+        return "   .   .   .   ";
     }
 
-    if (ifaddr != nullptr)
+    struct ifreq requests[16];
+
+    struct ifconf ifc;
+    ifc.ifc_len = sizeof(requests);
+    ifc.ifc_req = requests;
+
+    if (::ioctl(fd.fd(), SIOCGIFCONF, &ifc) == -1)
     {
-        ::freeifaddrs(ifaddr);
+        return "   .   .   .   ";
+    }
+
+    const size_t count = ifc.ifc_len / sizeof(struct ifreq);
+
+    for (size_t i = 0 ; i < count ; ++i)
+    {
+        const struct ifreq& request = requests[i];
+
+        if ((request.ifr_addr.sa_family == AF_INET) and
+            (strcmp(request.ifr_name, "lo") != 0))
+        {
+            const void *addr = &((const struct sockaddr_in *)&request.ifr_addr)->sin_addr;
+
+            char* buffer = getArena().allocate<char>(INET_ADDRSTRLEN);
+            ::inet_ntop(AF_INET, addr, buffer, INET_ADDRSTRLEN);
+            interface = request.ifr_name[0];
+
+            return buffer;
+        }
     }
 
-    return address;
+    return "   .   .   .   ";
 }
 
 //-------------------------------------------------------------------------
@@ -96,7 +110,7 @@ drawIpAddress(
                           getImage());
 
     char interface = ' ';
-    std::string ipaddress = getIpAddress(interface);
+    std::string_view ipaddress = getIpAddress(interface);
 
     position = drawChar(position,
                         interface,
@@ -109,19 +123,23 @@ drawIpAddress(
                           getImage());
 
     position = drawString(position,
-                          ipaddress + " ",
+                          ipaddress,
                           m_foreground,
                           getImage());
 
+    position = drawString(position,
+                          " ",
+                          m_foreground,
+                          getImage());
 }
 
 //-------------------------------------------------------------------------
 
-std::string
+std::string_view
 DynamicInfo::
 getTemperature()
 {
-    return std::to_string(ogsinf::getTemperature());
+    return getArena().format("%d", ogsinf::getTemperature(getArena()));
 }
 
 //-------------------------------------------------------------------------
@@ -136,7 +154,7 @@ drawTemperature(
                           m_heading,
                           getImage());
 
-    std::string temperatureString = getTemperature();
+    std::string_view temperatureString = getTemperature();
 
     position = drawString(position,
                           temperatureString,
@@ -159,18 +177,19 @@ drawTemperature(
 
 //-------------------------------------------------------------------------
 
-std::string
+std::string_view
 DynamicInfo::
 getTime(
     time_t now)
 {
-    char buffer[128];
+    constexpr size_t size{128};
+    char* buffer = getArena().allocate<char>(size);
 
     struct tm result;
     struct tm *lt = ::localtime_r(&now, &result);
-    std::strftime(buffer, sizeof(buffer), "%T", lt);
+    const size_t length = std::strftime(buffer, size, "%T", lt);
 
-    return buffer;
+    return std::string_view(buffer, length);
 }
 
 //-------------------------------------------------------------------------
@@ -186,10 +205,15 @@ drawTime(
                           m_heading,
                           getImage());
 
-    std::string timeString = getTime(now);
+    std::string_view timeString = getTime(now);
 
     position = drawString(position,
-                          timeString + " ",
+                          timeString,
+                          m_foreground,
+                          getImage());
+
+    position = drawString(position,
+                          " ",
                           m_foreground,
                           getImage());
 }
@@ -201,7 +225,7 @@ DynamicInfo::
 drawBatteryCharge(
     ogsfb32::FontPoint& position)
 {
-    auto bi = ogsinf::getBatteryInfo();
+    auto bi = ogsinf::getBatteryInfo(getArena());
 
     position = drawString(position,
                           " battery ",
@@ -209,7 +233,7 @@ drawBatteryCharge(
                           getImage());
 
     position = drawString(position,
-                          std::to_string(bi.charge) + "% ",
+                          getArena().format("%d%% ", bi.charge),
                           m_foreground,
                           getImage());
 
@@ -266,6 +290,7 @@ update(
     time_t now)
 {
     getImage().clear(m_background);
+    getArena().reset();
 
     //---------------------------------------------------------------------
 
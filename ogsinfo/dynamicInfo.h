@@ -30,7 +30,7 @@
 //-------------------------------------------------------------------------
 
 #include <cstdint>
-#include <string>
+#include <string_view>
 
 #include "image8880Font.h"
 #include "panel.h"
@@ -62,13 +62,13 @@ private:
     ogsfb32::RGB8880 m_warning;
     ogsfb32::RGB8880 m_background;
 
-    static std::string getIpAddress(char& interface);
+    std::string_view getIpAddress(char& interface);
     void drawIpAddress(ogsfb32::FontPoint& position);
 
-    static std::string getTemperature();
+    std::string_view getTemperature();
     void drawTemperature(ogsfb32::FontPoint& position);
 
-    static std::string getTime(time_t now);
+    std::string_view getTime(time_t now);
     void drawTime(ogsfb32::FontPoint& position, time_t now);
 
     void drawBatteryCharge(ogsfb32::FontPoint& position);
@@ -26,28 +26,32 @@
 //-------------------------------------------------------------------------
 
 #include <cstdint>
-#include <fstream>
+#include <cstdio>
+#include <cstring>
 #include <stdexcept>
 #include <system_error>
 
 #include <inttypes.h>
 #include <unistd.h>
 
+#include "frameArena.h"
 #include "memoryTrace.h"
+#include "system.h"
 
 //-------------------------------------------------------------------------
 
 MemoryStats::
-MemoryStats()
+MemoryStats(
+    ogsfb32::FrameArena& arena)
 :
     m_total{0},
     m_buffers{0},
     m_cached{0},
     m_used{0}
 {
-    std::ifstream ifs{"/proc/meminfo", std::ifstream::in};
+    const char* meminfo = ogsinf::readFile("/proc/meminfo", arena);
 
-    if (ifs.is_open() == false)
+    if (meminfo == nullptr)
     {
         throw std::system_error{errno,
                                 std::system_category(),
@@ -56,29 +60,36 @@ MemoryStats()
 
     uint32_t free{0};
 
-    while (ifs.eof() == false)
+    for (const char* line = meminfo ; *line != '\0' ; )
     {
-        std::string name;
-        uint32_t value;
-        std::string unit;
+        char name[32];
+        uint32_t value{0};
 
-        ifs >> name >> value >> unit;
-
-        if (name == "MemTotal:")
-        {
-            m_total = value;
-        }
-        else if (name == "MemFree:")
-        {
-            free = value;
-        }
-        else if (name == "Buffers:")
+        if (std::sscanf(line, "%31s %" SCNu32, name, &value) == 2)
         {
-            m_buffers = value;
+            if (std::strcmp(name, "MemTotal:") == 0)
+            {
+                m_total = value;
+            }
+            else if (std::strcmp(name, "MemFree:") == 0)
+            {
+                free = value;
+            }
+            else if (std::strcmp(name, "Buffers:") == 0)
+            {
+                m_buffers = value;
+            }
+            else if (std::strcmp(name, "Cached:") == 0)
+            {
+                m_cached = value;
+            }
         }
-        else if (name == "Cached:")
+
+        line += std::strcspn(line, "\n");
+
+        if (*line == '\n')
         {
-            m_cached = value;
+            ++line;
         }
     }
 
@@ -116,7 +127,9 @@ MemoryTrace::
 update(
     time_t now)
 {
-    MemoryStats memoryStats;
+    getArena().reset();
+
+    MemoryStats memoryStats{getArena()};
 
     int16_t used = (memoryStats.used() * m_traceScale)
                  / memoryStats.total();
@@ -127,6 +140,6 @@ update(
     int16_t cached = (memoryStats.cached() * m_traceScale)
                    / memoryStats.total();
 
-    Trace::addData(std::vector<int16_t>{used, buffers, cached}, now);
+    Trace::addData({used, buffers, cached}, now);
 }
 
@@ -39,6 +39,7 @@
 
 namespace ogsfb32
 {
+class FrameArena;
 class FrameBuffer8880;
 }
 
@@ -48,7 +49,7 @@ class MemoryStats
 {
 public:
 
-    MemoryStats();
+    explicit MemoryStats(ogsfb32::FrameArena& arena);
 
     uint32_t total() const { return m_total; }
     uint32_t buffers() const { return m_buffers; }
@@ -26,59 +26,69 @@
 //-------------------------------------------------------------------------
 
 #include <algorithm>
+#include <cinttypes>
 #include <cstdint>
+#include <cstdio>
+#include <cstring>
 #include <stdexcept>
-#include <string>
 #include <system_error>
 
-#include <ifaddrs.h>
-#include <netdb.h>
 #include <unistd.h>
 
-#include <arpa/inet.h>
-#include <linux/if_link.h>
-#include <sys/socket.h>
-
+#include "frameArena.h"
 #include "system.h"
 #include "networkTrace.h"
 
 //-------------------------------------------------------------------------
 
 NetworkStats::
-NetworkStats()
+NetworkStats(
+    ogsfb32::FrameArena& arena)
 :
     m_tx{0},
     m_rx{0}
 {
-    struct ifaddrs *ifaddr;
+    // Each interface has a line "name: <receive> <transmit>", with the
+    // byte count first in each group of eight.
+
+    const char* dev = ogsinf::readFile("/proc/net/dev", arena);
 
-    if (::getifaddrs(&ifaddr) == -1)
+    if (dev == nullptr)
     {
         throw std::system_error(errno,
                                 std::system_category(),
-                                "getifaddrs");
+                                "unable to open /proc/net/dev");
     }
 
-    struct ifaddrs *ifa = ifaddr;
-    for (ifa = ifaddr; ifa != nullptr; ifa = ifa->ifa_next)
+    for (const char* line = dev ; *line != '\0' ; )
     {
-        if (ifa->ifa_addr != nullptr)
-        {
-            int family = ifa->ifa_addr->sa_family;
+        const size_t length = std::strcspn(line, "\n");
+        const char* colon = static_cast<const char*>(std::memchr(line, ':', length));
 
-            if ((family == AF_PACKET) &&
-                (std::string(ifa->ifa_name) != "lo"))
+        if (colon != nullptr)
+        {
+            const char* name = line + std::strspn(line, " ");
+            uint64_t rx{0};
+            uint64_t tx{0};
+
+            if ((std::strncmp(name, "lo:", 3) != 0) and
+                (std::sscanf(colon + 1,
+                             "%" SCNu64 " %*u %*u %*u %*u %*u %*u %*u %" SCNu64,
+                             &rx,
+                             &tx) == 2))
             {
-                rtnl_link_stats* stats =
-                    static_cast<rtnl_link_stats*>(ifa->ifa_data);
-
-                m_tx += stats->tx_bytes;
-                m_rx += stats->rx_bytes;
+                m_tx += static_cast<uint32_t>(tx);
+                m_rx += static_cast<uint32_t>(rx);
             }
         }
-    }
 
-    ::freeifaddrs(ifaddr);
+        line += length;
+
+        if (*line == '\n')
+        {
+            ++line;
+        }
+    }
 }
 
 //-------------------------------------------------------------------------
@@ -123,7 +133,7 @@ NetworkTrace(
         "Network",
         std::vector<std::string>{"tx", "rx"},
         std::vector<ogsfb32::RGB8880>{{102, 167, 225}, {225, 225, 102}}),
-    m_previousStats{}
+    m_previousStats{getArena()}
 {
 }
 
@@ -134,7 +144,9 @@ NetworkTrace::
 update(
     time_t now)
 {
-    NetworkStats currentStats;
+    getArena().reset();
+
+    NetworkStats currentStats{getArena()};
 
     NetworkStats diff{currentStats - m_previousStats};
 
@@ -142,7 +154,7 @@ update(
     int16_t tx = std::max(zero, static_cast<int16_t>(diff.tx()));
     int16_t rx = std::max(zero, static_cast<int16_t>(diff.rx()));
 
-    Trace::addData(std::vector<int16_t>{tx, rx}, now);
+    Trace::addData({tx, rx}, now);
 
     m_previousStats = currentStats;
 }
@@ -39,6 +39,7 @@
 
 namespace ogsfb32
 {
+class FrameArena;
 class FrameBuffer8880;
 }
 
@@ -48,7 +49,7 @@ class NetworkStats
 {
 public:
 
-    NetworkStats();
+    explicit NetworkStats(ogsfb32::FrameArena& arena);
 
     uint32_t tx() const { return m_tx; }
     uint32_t rx() const { return m_rx; }
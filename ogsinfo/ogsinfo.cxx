@@ -25,7 +25,7 @@
 //
 //-------------------------------------------------------------------------
 
-#include <array>
+#include <algorithm>
 #include <chrono>
 #include <csignal>
 #include <cstdint>
@@ -33,7 +33,8 @@
 #include <exception>
 #include <iostream>
 #include <memory>
-#include <thread>
+#include <stdexcept>
+#include <system_error>
 #include <vector>
 
 #include <errno.h>
@@ -48,9 +49,13 @@
 #include <sys/time.h>
 #include <sys/types.h>
 
+#include "allocationCounter.h"
 #include "cpuTrace.h"
 #include "dynamicInfo.h"
+#include "eventLoop.h"
+#include "fileDescriptor.h"
 #include "framebuffer8880.h"
+#include "hotplugMonitor.h"
 #include "networkTrace.h"
 #include "memoryTrace.h"
 #include "temperatureTrace.h"
@@ -59,10 +64,14 @@
 
 namespace
 {
-volatile static std::sig_atomic_t run = 1;
-volatile static std::sig_atomic_t display = 1;
-
 const char* defaultDevice = "/dev/dri/card0";
+
+enum Layout
+{
+    LAYOUT_SINGLE,
+    LAYOUT_MIRROR,
+    LAYOUT_EXTEND
+};
 }
 
 //-------------------------------------------------------------------------
@@ -121,17 +130,6 @@ messageLog(
 
 //-------------------------------------------------------------------------
 
-void
-perrorLog(
-    bool isDaemon,
-    const std::string& name,
-    const std::string& s)
-{
-    messageLog(isDaemon, name, LOG_ERR, s + " - " + ::strerror(errno));
-}
-
-//-------------------------------------------------------------------------
-
 
 void
 printUsage(
@@ -141,10 +139,14 @@ printUsage(
     os << "\n";
     os << "Usage: " << name << " <options>\n";
     os << "\n";
+    os << "    --allocations,-a - report updates that allocated memory";
+    os << " on exit\n";
     os << "    --daemon,-D - start in the background as a daemon\n";
     os << "    --device,-d - dri device to use";
     os << " (default is " << defaultDevice << ")\n";
+    os << "    --extend,-e - share the panels out between all displays\n";
     os << "    --help,-h - print usage and exit\n";
+    os << "    --mirror,-m - show the panels on all displays\n";
     os << "    --pidfile,-p <pidfile> - create and lock PID file";
     os << " (if being run as a daemon)\n";
     os << "\n";
@@ -152,32 +154,6 @@ printUsage(
 
 //-------------------------------------------------------------------------
 
-static void
-signalHandler(
-    int signalNumber)
-{
-    switch (signalNumber)
-    {
-    case SIGINT:
-    case SIGTERM:
-
-        run = 0;
-        break;
-
-    case SIGUSR1:
-
-        display = 0;
-        break;
-
-    case SIGUSR2:
-
-        display = 1;
-        break;
-    };
-}
-
-//-------------------------------------------------------------------------
-
 int
 main(
     int argc,
@@ -187,14 +163,19 @@ main(
     char* program = basename(argv[0]);
     char* pidfile = nullptr;
     bool isDaemon =  false;
+    Layout layout = LAYOUT_SINGLE;
+    bool checkAllocations = false;
 
     //---------------------------------------------------------------------
 
-    static const char* sopts = "d:hp:D";
+    static const char* sopts = "ad:ehmp:D";
     static struct option lopts[] = 
     {
+        { "allocations", no_argument, nullptr, 'a' },
         { "device", required_argument, nullptr, 'd' },
+        { "extend", no_argument, nullptr, 'e' },
         { "help", no_argument, nullptr, 'h' },
+        { "mirror", no_argument, nullptr, 'm' },
         { "pidfile", required_argument, nullptr, 'p' },
         { "daemon", no_argument, nullptr, 'D' },
         { nullptr, no_argument, nullptr, 0 }
@@ -206,12 +187,24 @@ main(
     {
         switch (opt)
         {
+        case 'a':
+
+            checkAllocations = true;
+
+            break;
+
         case 'd':
 
             device = optarg;
 
             break;
 
+        case 'e':
+
+            layout = LAYOUT_EXTEND;
+
+            break;
+
         case 'h':
 
             printUsage(std::cout, program);
@@ -219,6 +212,12 @@ main(
 
             break;
 
+        case 'm':
+
+            layout = LAYOUT_MIRROR;
+
+            break;
+
         case 'p':
 
             pidfile = optarg;
@@ -285,36 +284,78 @@ main(
 
     //---------------------------------------------------------------------
 
-    constexpr std::array<int, 4> signals = { SIGINT, SIGTERM, SIGUSR1, SIGUSR2 };
-
-    for (auto signal : signals)
+    try
     {
-        if (std::signal(signal, signalHandler) == SIG_ERR)
+        ogsfb32::FileDescriptor drm{::open(device, O_RDWR)};
+
+        if (drm.fd() == -1)
         {
-            if (pfh)
+            throw std::system_error{errno,
+                                    std::system_category(),
+                                    std::string("cannot open dri device ") + device};
+        }
+
+        ogsfb32::HotplugMonitor hotplug;
+
+        //-----------------------------------------------------------------
+
+        // There is a frame buffer for each display in use. Those that are
+        // still connected are kept when displays are plugged in or
+        // removed.
+
+        using FrameBuffers = std::vector<std::unique_ptr<ogsfb32::FrameBuffer8880>>;
+
+        FrameBuffers fbs;
+
+        auto updateDisplays = [&]
+        {
+            auto displays = ogsfb32::FrameBuffer8880::getDisplays(drm);
+
+            if ((layout == LAYOUT_SINGLE) and (displays.size() > 1))
             {
-                ::pidfile_remove(pfh);
+                displays.resize(1);
             }
 
-            std::string message {"installing "};
-            message += strsignal(signal);
-            message += " signal handler";
+            FrameBuffers updated;
 
-            perrorLog(isDaemon, program, message);
-            ::exit(EXIT_FAILURE);
-        }
-    }
+            for (const auto& display : displays)
+            {
+                auto found = std::find_if(fbs.begin(),
+                                          fbs.end(),
+                                          [&display](const auto& fb)
+                                          {
+                                              return fb and (fb->getName() == display.name);
+                                          });
+
+                if (found != fbs.end())
+                {
+                    updated.push_back(std::move(*found));
+                }
+                else
+                {
+                    ogsfb32::FrameBuffer8880::Options options;
+                    options.connector = display.name;
 
-    //---------------------------------------------------------------------
+                    updated.push_back(
+                        std::make_unique<ogsfb32::FrameBuffer8880>(drm, options));
+                }
 
-    try
-    {
-        ogsfb32::FrameBuffer8880 fb(device);
+                updated.back()->clear(ogsfb32::RGB8880{0, 0, 0});
+            }
 
-        fb.clear(ogsfb32::RGB8880{0, 0, 0});
+            fbs = std::move(updated);
+        };
+
+        updateDisplays();
+
+        if (fbs.empty())
+        {
+            throw std::logic_error("no connected CRTC found");
+        }
 
         //-----------------------------------------------------------------
 
+        const int16_t panelWidth = fbs.front()->getWidth();
         constexpr int16_t traceHeight = 100;
         constexpr int16_t gridHeight = traceHeight / 5;
 
@@ -335,34 +376,106 @@ main(
         };
 
         panels.push_back(
-            std::make_unique<DynamicInfo>(fb.getWidth(),
+            std::make_unique<DynamicInfo>(panelWidth,
                                            panelTop(panels)));
 
         panels.push_back(
-            std::make_unique<CpuTrace>(fb.getWidth(),
+            std::make_unique<CpuTrace>(panelWidth,
                                         traceHeight,
                                         panelTop(panels),
                                         gridHeight));
 
         panels.push_back(
-            std::make_unique<MemoryTrace>(fb.getWidth(),
+            std::make_unique<MemoryTrace>(panelWidth,
                                            traceHeight,
                                            panelTop(panels),
                                            gridHeight));
 
         panels.push_back(
-            std::make_unique<NetworkTrace>(fb.getWidth(),
+            std::make_unique<NetworkTrace>(panelWidth,
                                            traceHeight,
                                            panelTop(panels),
                                            gridHeight));
 
         //-----------------------------------------------------------------
 
-        constexpr auto oneSecond(std::chrono::seconds(1));
+        // When mirrored every display shows all the panels. When extended
+        // the panels are shared out between the displays in order, and
+        // stacked from the top of each.
+
+        auto show = [&]
+        {
+            if (layout != LAYOUT_EXTEND)
+            {
+                for (auto& fb : fbs)
+                {
+                    for (auto& panel : panels)
+                    {
+                        panel->show(*fb);
+                    }
+                }
+            }
+            else
+            {
+                int16_t yPosition = 0;
+                size_t previous = 0;
+
+                for (size_t i = 0 ; i < panels.size() ; ++i)
+                {
+                    const size_t index = (i * fbs.size()) / panels.size();
+
+                    if (index != previous)
+                    {
+                        yPosition = 0;
+                        previous = index;
+                    }
 
-        std::this_thread::sleep_for(oneSecond);
+                    panels[i]->setYPosition(yPosition);
+                    panels[i]->show(*fbs[index]);
+                    yPosition = panels[i]->getBottom();
+                }
+            }
 
-        while (run)
+            for (auto& fb : fbs)
+            {
+                fb->present();
+            }
+        };
+
+        //-----------------------------------------------------------------
+
+        bool display = true;
+
+        ogsfb32::EventLoop loop;
+
+        loop.addSignal(SIGINT, [&loop] { loop.stop(); });
+        loop.addSignal(SIGTERM, [&loop] { loop.stop(); });
+        loop.addSignal(SIGUSR1, [&display] { display = false; });
+        loop.addSignal(SIGUSR2, [&display] { display = true; });
+
+        loop.addReader(hotplug.fd(), [&]
+        {
+            if (hotplug.read())
+            {
+                messageLog(isDaemon, program, LOG_INFO, "displays changed");
+                updateDisplays();
+            }
+        });
+
+        // Page flips from present() are read here, from whichever frame
+        // buffer is first, as they all share the device.
+
+        loop.addReader(drm.fd(), [&fbs]
+        {
+            if (not fbs.empty())
+            {
+                fbs.front()->handleEvents();
+            }
+        });
+
+        ogsfb32::AllocationCounter allocations;
+
+        loop.addTimer(std::chrono::seconds(1), [&]
         {
             auto now = std::chrono::system_clock::now();
             auto now_t = std::chrono::system_clock::to_time_t(now);
@@ -370,17 +483,36 @@ main(
             for (auto& panel : panels)
             {
                 panel->update(now_t);
+            }
 
-                if (display)
-                {
-                    panel->show(fb);
-                }
+            if (display)
+            {
+                show();
             }
 
-            std::this_thread::sleep_for(oneSecond);
+            if (checkAllocations)
+            {
+                allocations.endFrame();
+            }
+        });
+
+        loop.run();
+
+        if (checkAllocations)
+        {
+            messageLog(isDaemon,
+                       program,
+                       LOG_INFO,
+                       std::to_string(allocations.getAllocatingFrames()) +
+                       " of " +
+                       std::to_string(allocations.getFrames()) +
+                       " updates allocated memory");
         }
 
-        fb.clear();
+        for (auto& fb : fbs)
+        {
+            fb->clear();
+        }
     }
     catch (std::exception& error)
     {
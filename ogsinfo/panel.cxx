@@ -34,6 +34,9 @@ Panel::
 show(
     const ogsfb32::FrameBuffer8880& fb) const
 {
-    fb.putImage(ogsfb32::FB8880Point(0, m_yPosition), m_image);
+    const ogsfb32::FB8880Point position(m_xPosition, m_yPosition);
+
+    fb.putImage(position, m_image);
+    fb.addDamage(position, m_image.getWidth(), m_image.getHeight());
 }
 
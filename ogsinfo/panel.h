@@ -31,6 +31,7 @@
 
 #include <cstdint>
 
+#include "frameArena.h"
 #include "framebuffer8880.h"
 #include "image8880.h"
 
@@ -45,8 +46,10 @@ public:
         int16_t height,
         int16_t yPosition)
     :
+        m_xPosition{0},
         m_yPosition{yPosition},
-        m_image{width, height}
+        m_image{width, height},
+        m_arena{}
     { }
 
 
@@ -54,15 +57,25 @@ public:
 
     int16_t getBottom() const { return m_yPosition + m_image.getHeight(); }
 
+    void setXPosition(int16_t xPosition) { m_xPosition = xPosition; }
+    void setYPosition(int16_t yPosition) { m_yPosition = yPosition; }
+
     ogsfb32::Image8880& getImage() { return m_image; }
     const ogsfb32::Image8880& getImage() const { return m_image; }
 
+    // Scratch memory for an update, such as the text it draws. It is
+    // reset at the start of each update that uses it.
+
+    ogsfb32::FrameArena& getArena() { return m_arena; }
+
     void show(const ogsfb32::FrameBuffer8880& fb) const;
     virtual void update(time_t now) = 0;
 
 private:
 
+    int16_t m_xPosition;
     int16_t m_yPosition;
     ogsfb32::Image8880 m_image;
+    ogsfb32::FrameArena m_arena;
 };
 
@@ -0,0 +1,123 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+#include "frameArena.h"
+#include "profiler.h"
+#include "profileTrace.h"
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+
+//-------------------------------------------------------------------------
+
+std::vector<ogsfb32::RGB8880>
+traceColours(
+    size_t traces)
+{
+    const std::vector<ogsfb32::RGB8880> colours{{217, 95, 2},
+                                                 {27, 158, 119},
+                                                 {117, 112, 179},
+                                                 {231, 41, 138},
+                                                 {230, 171, 2}};
+
+    std::vector<ogsfb32::RGB8880> result;
+
+    for (size_t i = 0 ; i < traces ; ++i)
+    {
+        result.push_back(colours[i % colours.size()]);
+    }
+
+    return result;
+}
+
+//-------------------------------------------------------------------------
+
+}
+
+//-------------------------------------------------------------------------
+
+ProfileTrace::
+ProfileTrace(
+    int16_t width,
+    int16_t traceHeight,
+    int16_t yPosition,
+    int16_t scaleMilliseconds,
+    const std::vector<std::string>& scopeNames,
+    const std::vector<std::string>& labels,
+    int16_t gridHeight)
+:
+    TraceStack(
+        width,
+        traceHeight,
+        scaleMilliseconds * 10,
+        yPosition,
+        gridHeight,
+        scopeNames.size(),
+        "",
+        labels,
+        traceColours(scopeNames.size())),
+    m_scopeNames(scopeNames),
+    m_lastUpdate{ogsfb32::Profiler::now()},
+    m_frame{0}
+{
+}
+
+//-------------------------------------------------------------------------
+
+void
+ProfileTrace::
+update(
+    time_t)
+{
+    using ogsfb32::Profiler;
+
+    constexpr uint64_t nanosecondsPerTenth{100000};
+    constexpr uint64_t maxValue{std::numeric_limits<int16_t>::max()};
+
+    getArena().reset();
+
+    const auto now = Profiler::now();
+    ogsfb32::ArenaVector<int16_t> values{ogsfb32::ArenaAllocator<int16_t>{getArena()}};
+    values.reserve(m_scopeNames.size());
+
+    for (const auto& name : m_scopeNames)
+    {
+        auto tenths = Profiler::duration(name, m_lastUpdate) / nanosecondsPerTenth;
+        values.push_back(static_cast<int16_t>(std::min(tenths, maxValue)));
+    }
+
+    m_lastUpdate = now;
+
+    Trace::addData(values.data(), values.size(), m_frame++);
+}
@@ -25,25 +25,109 @@
 //
 //-------------------------------------------------------------------------
 
+#include <cerrno>
 #include <cstdint>
-#include <fstream>
-#include <regex>
+#include <cstdlib>
+#include <cstring>
 
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "fileDescriptor.h"
+#include "frameArena.h"
 #include "system.h"
 
 //-------------------------------------------------------------------------
 
+namespace
+{
+
+//-------------------------------------------------------------------------
+
+// Returns the value of a KEY=value line of a uevent file, or nullptr if
+// there isn't one.
+
+const char*
+ueventValue(
+    const char* uevent,
+    const char* key)
+{
+    const size_t length = std::strlen(key);
+
+    for (const char* line = uevent ; line != nullptr ; )
+    {
+        if ((std::strncmp(line, key, length) == 0) and (line[length] == '='))
+        {
+            return line + length + 1;
+        }
+
+        line = std::strchr(line, '\n');
+
+        if (line != nullptr)
+        {
+            ++line;
+        }
+    }
+
+    return nullptr;
+}
+
+//-------------------------------------------------------------------------
+
+}
+
+//-------------------------------------------------------------------------
+
+const char*
+ogsinf::
+readFile(
+    const char* path,
+    ogsfb32::FrameArena& arena,
+    size_t size)
+{
+    ogsfb32::FileDescriptor fd{::open(path, O_RDONLY)};
+
+    if (fd.fd() == -1)
+    {
+        return nullptr;
+    }
+
+    char* buffer = arena.allocate<char>(size);
+    size_t length = 0;
+
+    while (length < (size - 1))
+    {
+        const ssize_t bytes = ::read(fd.fd(), buffer + length, size - 1 - length);
+
+        if (bytes > 0)
+        {
+            length += bytes;
+        }
+        else if ((bytes == 0) or (errno != EINTR))
+        {
+            break;
+        }
+    }
+
+    buffer[length] = '\0';
+
+    return buffer;
+}
+
+//-------------------------------------------------------------------------
+
 int16_t
 ogsinf::
-getTemperature()
+getTemperature(
+    ogsfb32::FrameArena& arena)
 {
     int millidegrees = 0;
 
-    std::ifstream ifs{"/sys/class/thermal/thermal_zone0/temp"};
+    const char* text = readFile("/sys/class/thermal/thermal_zone0/temp", arena, 32);
 
-    if (ifs.is_open())
+    if (text != nullptr)
     {
-        ifs >> millidegrees;
+        millidegrees = std::atoi(text);
     }
 
     return static_cast<int16_t>((millidegrees + 500) / 1000);
@@ -53,71 +137,35 @@ getTemperature()
 
 ogsinf::BatteryInfo
 ogsinf::
-getBatteryInfo()
+getBatteryInfo(
+    ogsfb32::FrameArena& arena)
 {
     int percent = 0;
     bool isCharging = false;
 
+    const char* ac = readFile("/sys/class/power_supply/ac/uevent", arena);
+
+    if (ac != nullptr)
     {
-        std::ifstream ifs{"/sys/class/power_supply/ac/uevent"};
+        const char* status = ueventValue(ac, "POWER_SUPPLY_STATUS");
 
-        if (ifs.is_open())
+        if (status != nullptr)
         {
-            std::string line;
-            while (getline(ifs, line))
-            {
-                try
-                {
-                    if (line.rfind("POWER_SUPPLY_STATUS=", 0) == 0)
-                    {
-                        std::regex pattern{R"(POWER_SUPPLY_STATUS=([a-zA-Z]+))"};
-                        std::smatch match;
-       
-                        if (std::regex_search(line, match, pattern) &&
-                            (match.size() == 2))
-                        {
-                            isCharging = (match[1].str() != "Discharging");
-                        }
-                    }
-                }
-                catch (std::exception&)
-                {
-                    // ignore
-                }
-            }
+            isCharging = (std::strncmp(status, "Discharging", 11) != 0);
         }
     }
 
+    const char* battery = readFile("/sys/class/power_supply/battery/uevent", arena);
+
+    if (battery != nullptr)
     {
-        std::ifstream ifs{"/sys/class/power_supply/battery/uevent"};
+        const char* capacity = ueventValue(battery, "POWER_SUPPLY_CAPACITY");
 
-        if (ifs.is_open())
+        if (capacity != nullptr)
         {
-            std::string line;
-            while (getline(ifs, line))
-            {
-                try
-                {
-                    if (line.rfind("POWER_SUPPLY_CAPACITY=", 0) == 0)
-                    {
-                        std::regex pattern{R"(POWER_SUPPLY_CAPACITY=(\d+))"};
-                        std::smatch match;
-       
-                        if (std::regex_search(line, match, pattern) &&
-                            (match.size() == 2))
-                        {
-                            percent = std::stoi(match[1].str());
-                        }
-                    }
-                }
-                catch (std::exception&)
-                {
-                    // ignore
-                }
-            }
+            percent = std::atoi(capacity);
         }
     }
 
     return BatteryInfo{static_cast<int16_t>(percent), isCharging};
 }
-
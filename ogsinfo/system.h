@@ -29,16 +29,35 @@
 
 //-------------------------------------------------------------------------
 
+#include <cstddef>
 #include <cstdint>
 
 //-------------------------------------------------------------------------
 
+namespace ogsfb32
+{
+class FrameArena;
+}
+
+//-------------------------------------------------------------------------
+
 namespace ogsinf
 {
 
 //-------------------------------------------------------------------------
 
-int16_t getTemperature();
+// Reads up to size - 1 bytes of a file into the arena, followed by a
+// null. Returns nullptr if the file cannot be opened.
+
+const char*
+readFile(
+    const char* path,
+    ogsfb32::FrameArena& arena,
+    size_t size = 4096);
+
+//-------------------------------------------------------------------------
+
+int16_t getTemperature(ogsfb32::FrameArena& arena);
 
 //-------------------------------------------------------------------------
 
@@ -48,7 +67,7 @@ struct BatteryInfo
     bool isCharging;
 };
 
-BatteryInfo getBatteryInfo();
+BatteryInfo getBatteryInfo(ogsfb32::FrameArena& arena);
 
 //-------------------------------------------------------------------------
 
@@ -64,8 +64,10 @@ TemperatureTrace::
 update(
     time_t now)
 {
-    int16_t temperature = ogsinf::getTemperature();
+    getArena().reset();
 
-    Trace::addData(std::vector<int16_t>{temperature}, now);
+    int16_t temperature = ogsinf::getTemperature(getArena());
+
+    Trace::addData({temperature}, now);
 }
 
@@ -91,12 +91,15 @@ Trace(
 
     ogsfb32::FontPoint position(0, m_traceHeight + 2);
 
-    position =
-        drawString(
-            ogsfb32::FontPoint(0, m_traceHeight + 2),
-            title + " (",
-            sc_foreground,
-            getImage());
+    if (not title.empty())
+    {
+        position =
+            drawString(
+                ogsfb32::FontPoint(0, m_traceHeight + 2),
+                title + " (",
+                sc_foreground,
+                getImage());
+    }
 
     bool first = true;
     for (auto& trace : m_traceData)
@@ -123,10 +126,13 @@ Trace(
                             getImage());
     }
 
-    position = drawString(position,
-                          ")",
-                          sc_foreground,
-                          getImage());
+    if (not title.empty())
+    {
+        position = drawString(position,
+                              ")",
+                              sc_foreground,
+                              getImage());
+    }
 
     for (auto j = 0 ; j < traceHeight + 1 ; j+= m_gridHeight)
     {
@@ -152,7 +158,8 @@ getLegendHeight()
 void
 Trace::
 addData(
-    const std::vector<int16_t>& data,
+    const int16_t* data,
+    size_t count,
     time_t now)
 {
     int16_t index{0};
@@ -177,10 +184,9 @@ addData(
 
     //-----------------------------------------------------------------
 
-    auto value = data.begin();
-    for (auto& trace : m_traceData)
+    for (size_t i = 0 ; i < m_traceData.size() ; ++i)
     {
-        trace.m_values[index] = *(value++);
+        m_traceData[i].m_values[index] = (i < count) ? data[i] : 0;
     }
 
     m_time[index] = now % 60;
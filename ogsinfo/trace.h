@@ -30,6 +30,7 @@
 //-------------------------------------------------------------------------
 
 #include <cstdint>
+#include <initializer_list>
 #include <string>
 #include <vector>
 
@@ -80,7 +81,18 @@ public:
 
 protected:
 
-    void addData(const std::vector<int16_t>& data, time_t now);
+    // There is a value for each trace. Missing values are zero.
+
+    void addData(const int16_t* data, size_t count, time_t now);
+
+    void
+    addData(
+        std::initializer_list<int16_t> data,
+        time_t now)
+    {
+        addData(data.begin(), data.size(), now);
+    }
+
     virtual void draw() = 0;
 
     int16_t m_traceHeight;
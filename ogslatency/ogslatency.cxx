@@ -0,0 +1,412 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <getopt.h>
+#include <libgen.h>
+
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "atomicModeset.h"
+#include "eventLoop.h"
+#include "framebuffer8880.h"
+#include "image8880.h"
+#include "joystick.h"
+#include "virtualJoystick.h"
+
+//-------------------------------------------------------------------------
+
+using namespace std::chrono_literals;
+using namespace ogsfb32;
+
+using Clock = std::chrono::steady_clock;
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+
+const char* defaultDevice = "/dev/dri/card0";
+constexpr int defaultCount = 200;
+
+// Synthetic presses are spaced so that they land at a different point in
+// the frame each time, rather than in step with the display.
+
+constexpr auto clickInterval = 97ms;
+
+//-------------------------------------------------------------------------
+
+struct Sample
+{
+    Clock::time_point input;
+    Clock::time_point react;
+    Clock::time_point display;
+};
+
+//-------------------------------------------------------------------------
+
+// frame is the count of page flips, or the vertical blank sequence, when
+// the reaction was drawn.
+
+struct Pending
+{
+    Clock::time_point input;
+    Clock::time_point react;
+    uint32_t frame;
+};
+
+//-------------------------------------------------------------------------
+
+double
+milliseconds(
+    Clock::duration duration)
+{
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+//-------------------------------------------------------------------------
+
+void
+printDistribution(
+    std::ostream& os,
+    const std::string& name,
+    std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+
+    auto percentile = [&values](int percent)
+    {
+        const size_t rank = (percent * values.size() + 99) / 100;
+        return values[std::max<size_t>(rank, 1) - 1];
+    };
+
+    os << std::left << std::setw(18) << name << std::right;
+
+    for (const double value : { values.front(),
+                                percentile(50),
+                                percentile(95),
+                                percentile(99),
+                                values.back() })
+    {
+        os << std::setw(9) << value;
+    }
+
+    os << "\n";
+}
+
+//-------------------------------------------------------------------------
+
+void
+printReport(
+    std::ostream& os,
+    const std::vector<Sample>& samples)
+{
+    os << "samples: " << samples.size() << "\n";
+
+    if (samples.empty())
+    {
+        return;
+    }
+
+    std::vector<double> inputToReact;
+    std::vector<double> reactToDisplay;
+    std::vector<double> inputToDisplay;
+
+    for (const auto& sample : samples)
+    {
+        inputToReact.push_back(milliseconds(sample.react - sample.input));
+        reactToDisplay.push_back(milliseconds(sample.display - sample.react));
+        inputToDisplay.push_back(milliseconds(sample.display - sample.input));
+    }
+
+    os << std::fixed << std::setprecision(2);
+    os << std::left << std::setw(18) << "(ms)" << std::right;
+
+    for (const char* heading : { "min", "median", "p95", "p99", "max" })
+    {
+        os << std::setw(9) << heading;
+    }
+
+    os << "\n";
+
+    printDistribution(os, "input to react", inputToReact);
+    printDistribution(os, "react to display", reactToDisplay);
+    printDistribution(os, "input to display", inputToDisplay);
+}
+
+}
+
+//-------------------------------------------------------------------------
+
+void
+printUsage(
+    std::ostream& os,
+    const std::string& name)
+{
+    os << "\n";
+    os << "Usage: " << name << " <options>\n";
+    os << "\n";
+    os << "    --count,-c <samples> - presses to measure";
+    os << " (default is " << defaultCount << ")\n";
+    os << "    --device,-d - dri device to use";
+    os << " (default is " << defaultDevice << ")\n";
+    os << "    --help,-h - print usage and exit\n";
+    os << "    --joystick,-j <device> - evdev device to read";
+    os << " (default is all joysticks)\n";
+    os << "    --uinput,-u - press buttons on a virtual joystick\n";
+    os << "\n";
+}
+
+//-------------------------------------------------------------------------
+
+int
+main(
+    int argc,
+    char *argv[])
+{
+    const char* device = defaultDevice;
+    char* program = basename(argv[0]);
+    int count = defaultCount;
+    std::string joystickDevice;
+    bool uinput = false;
+
+    //---------------------------------------------------------------------
+
+    static const char* sopts = "c:d:hj:u";
+    static struct option lopts[] = 
+    {
+        { "count", required_argument, nullptr, 'c' },
+        { "device", required_argument, nullptr, 'd' },
+        { "help", no_argument, nullptr, 'h' },
+        { "joystick", required_argument, nullptr, 'j' },
+        { "uinput", no_argument, nullptr, 'u' },
+        { nullptr, no_argument, nullptr, 0 }
+    };
+
+    int opt = 0;
+
+    while ((opt = ::getopt_long(argc, argv, sopts, lopts, nullptr)) != -1)
+    {
+        switch (opt)
+        {
+        case 'c':
+
+            count = std::max(1, std::atoi(optarg));
+
+            break;
+
+        case 'd':
+
+            device = optarg;
+
+            break;
+
+        case 'h':
+
+            printUsage(std::cout, program);
+            ::exit(EXIT_SUCCESS);
+
+            break;
+
+        case 'j':
+
+            joystickDevice = optarg;
+
+            break;
+
+        case 'u':
+
+            uinput = true;
+
+            break;
+
+        default:
+
+            printUsage(std::cerr, program);
+            ::exit(EXIT_FAILURE);
+
+            break;
+        }
+    }
+
+    //---------------------------------------------------------------------
+
+    try
+    {
+        std::unique_ptr<VirtualJoystick> virtualJoystick;
+
+        if (uinput)
+        {
+            virtualJoystick = std::make_unique<VirtualJoystick>();
+            joystickDevice = virtualJoystick->devicePath();
+        }
+
+        auto js = (joystickDevice.empty())
+                ? std::make_unique<Joystick>()
+                : std::make_unique<Joystick>(joystickDevice);
+
+        FrameBuffer8880 fb(device);
+        fb.clear(RGB8880{0, 0, 0});
+        fb.present();
+
+        if (not fb.requestVblankEvent())
+        {
+            throw std::runtime_error("display does not deliver vertical blank events");
+        }
+
+        // Each reaction flips a square in the middle of the screen between
+        // black and white, as a photodiode target.
+
+        Image8880 black{ 128, 128 };
+        Image8880 white{ 128, 128 };
+        black.clear(RGB8880{0, 0, 0});
+        white.clear(RGB8880{255, 255, 255});
+
+        const FB8880Point squarePosition{ (fb.getWidth() - 128) / 2,
+                                          (fb.getHeight() - 128) / 2 };
+        bool isWhite = false;
+
+        std::vector<Sample> samples;
+        samples.reserve(count);
+        std::optional<Pending> pending;
+
+        EventLoop loop;
+
+        for (const int signalNumber : { SIGINT, SIGTERM })
+        {
+            loop.addSignal(signalNumber, [&loop] { loop.stop(); });
+        }
+
+        loop.addReader(js->fd(), [&js] { js->read(); });
+
+        if (virtualJoystick)
+        {
+            // Legacy button 1 is (A) with either built in mapping.
+
+            loop.addTimer(clickInterval, [&virtualJoystick]
+            {
+                virtualJoystick->click(1);
+            });
+        }
+
+        // With atomic modesetting a change is on the screen when the
+        // commit that carries it completes, which is timed by its page
+        // flip event. Otherwise it is sent as damage, and first shown in
+        // full by the refresh that starts at the next vertical blank.
+
+        const auto atomic = fb.getAtomic();
+
+        auto frameNumber = [&]
+        {
+            return (atomic) ? atomic->getFlips() : fb.getVblankSequence();
+        };
+
+        auto displayTime = [&]
+        {
+            return (atomic) ? atomic->getFlipTime() : fb.getVblankTime();
+        };
+
+        // Once per frame, as an application paced by the display would.
+
+        auto frame = [&]
+        {
+            std::optional<Clock::time_point> input;
+
+            for (int button = 0 ; button < js->numberOfButtons() ; ++button)
+            {
+                if (js->buttonPressed(button))
+                {
+                    const auto time = js->buttonTime(button);
+                    input = (input) ? std::max(*input, time) : time;
+                }
+            }
+
+            // A reaction waits for the commit of the cleared screen, so
+            // that the next flip is the one that shows it.
+
+            if (input and not pending and not (atomic and atomic->isPending()))
+            {
+                isWhite = not isWhite;
+                fb.putImage(squarePosition, (isWhite) ? white : black);
+                fb.addDamage(squarePosition, black.getWidth(), black.getHeight());
+                pending = Pending{ *input, Clock::now(), frameNumber() };
+                fb.present();
+            }
+        };
+
+        loop.addReader(fb.getFd(), [&]
+        {
+            const bool vblank = fb.handleEvents();
+
+            if (pending and (frameNumber() != pending->frame))
+            {
+                samples.push_back(Sample{ pending->input,
+                                          pending->react,
+                                          displayTime() });
+                pending.reset();
+
+                if (static_cast<int>(samples.size()) == count)
+                {
+                    loop.stop();
+                    return;
+                }
+            }
+
+            if (vblank)
+            {
+                frame();
+                fb.requestVblankEvent();
+            }
+        });
+
+        loop.run();
+
+        fb.clear();
+
+        printReport(std::cout, samples);
+    }
+    catch (std::exception& error)
+    {
+        std::cerr << "Error: " << error.what() << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    //---------------------------------------------------------------------
+
+    return 0 ;
+}
+
@@ -0,0 +1,192 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <linux/uinput.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+
+#include "virtualJoystick.h"
+
+//-------------------------------------------------------------------------
+
+namespace
+{
+
+//-------------------------------------------------------------------------
+
+std::string
+findEventNode(
+    const std::string& sysName)
+{
+    const std::string directoryName = "/sys/devices/virtual/input/" + sysName;
+
+    // The event node is added by the kernel after UI_DEV_CREATE returns,
+    // so allow it a moment to appear.
+
+    for (int attempt = 0 ; attempt < 100 ; ++attempt)
+    {
+        DIR* directory = ::opendir(directoryName.c_str());
+
+        if (directory != nullptr)
+        {
+            std::string node;
+
+            while (struct dirent* entry = ::readdir(directory))
+            {
+                if (std::strncmp(entry->d_name, "event", 5) == 0)
+                {
+                    node = std::string("/dev/input/") + entry->d_name;
+                }
+            }
+
+            ::closedir(directory);
+
+            if (not node.empty() and (::access(node.c_str(), R_OK) == 0))
+            {
+                return node;
+            }
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    throw std::runtime_error("cannot find event device for " + sysName);
+}
+
+//-------------------------------------------------------------------------
+
+} // namespace
+
+//-------------------------------------------------------------------------
+
+VirtualJoystick::VirtualJoystick()
+:
+    m_uinputFd{::open("/dev/uinput", O_WRONLY | O_NONBLOCK | O_CLOEXEC)},
+    m_devicePath()
+{
+    if (m_uinputFd.fd() == -1)
+    {
+        throw std::system_error{errno,
+                                std::system_category(),
+                                "cannot open /dev/uinput"};
+    }
+
+    const int fd = m_uinputFd.fd();
+
+    if (::ioctl(fd, UI_SET_EVBIT, EV_KEY) == -1)
+    {
+        throw std::system_error{errno,
+                                std::system_category(),
+                                "cannot enable uinput key events"};
+    }
+
+    for (int button = 0 ; button < buttonCount ; ++button)
+    {
+        if (::ioctl(fd, UI_SET_KEYBIT, BTN_TRIGGER_HAPPY1 + button) == -1)
+        {
+            throw std::system_error{errno,
+                                    std::system_category(),
+                                    "cannot enable uinput button"};
+        }
+    }
+
+    struct uinput_setup setup{};
+    setup.id.bustype = BUS_VIRTUAL;
+    setup.id.vendor = 0x1209;
+    setup.id.product = 0x0001;
+    std::strncpy(setup.name, "ogslatency virtual joystick", UINPUT_MAX_NAME_SIZE - 1);
+
+    if ((::ioctl(fd, UI_DEV_SETUP, &setup) == -1) or
+        (::ioctl(fd, UI_DEV_CREATE) == -1))
+    {
+        throw std::system_error{errno,
+                                std::system_category(),
+                                "cannot create uinput device"};
+    }
+
+    char sysName[64]{};
+
+    if (::ioctl(fd, UI_GET_SYSNAME(sizeof(sysName)), sysName) == -1)
+    {
+        throw std::system_error{errno,
+                                std::system_category(),
+                                "cannot read uinput device name"};
+    }
+
+    m_devicePath = findEventNode(sysName);
+}
+
+//-------------------------------------------------------------------------
+
+VirtualJoystick::~VirtualJoystick()
+{
+    ::ioctl(m_uinputFd.fd(), UI_DEV_DESTROY);
+}
+
+//-------------------------------------------------------------------------
+
+void
+VirtualJoystick::click(
+    int button)
+{
+    emit(EV_KEY, BTN_TRIGGER_HAPPY1 + button, 1);
+    emit(EV_SYN, SYN_REPORT, 0);
+    emit(EV_KEY, BTN_TRIGGER_HAPPY1 + button, 0);
+    emit(EV_SYN, SYN_REPORT, 0);
+}
+
+//-------------------------------------------------------------------------
+
+void
+VirtualJoystick::emit(
+    int type,
+    int code,
+    int value)
+{
+    struct input_event event{};
+    event.type = type;
+    event.code = code;
+    event.value = value;
+
+    if (::write(m_uinputFd.fd(), &event, sizeof(event)) != sizeof(event))
+    {
+        throw std::system_error{errno,
+                                std::system_category(),
+                                "cannot write uinput event"};
+    }
+}
+
@@ -0,0 +1,71 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#pragma once
+
+//-------------------------------------------------------------------------
+
+#include <string>
+
+#include "fileDescriptor.h"
+
+//-------------------------------------------------------------------------
+
+// A joystick created through uinput, for driving a program with synthetic
+// button presses. It has the 18 buttons of the Odroid Go Super, as
+// BTN_TRIGGER_HAPPY1 to BTN_TRIGGER_HAPPY18, so button n is the legacy
+// button number n.
+
+class VirtualJoystick
+{
+public:
+
+    static constexpr int buttonCount = 18;
+
+    VirtualJoystick();
+    ~VirtualJoystick();
+
+    VirtualJoystick(const VirtualJoystick&) = delete;
+    VirtualJoystick& operator=(const VirtualJoystick&) = delete;
+
+    // The /dev/input/event* node the kernel created for the device.
+
+    const std::string& devicePath() const { return m_devicePath; }
+
+    // Press and release a button.
+
+    void click(int button);
+
+private:
+
+    void emit(int type, int code, int value);
+
+    ogsfb32::FileDescriptor m_uinputFd;
+    std::string m_devicePath;
+};
+
@@ -60,7 +60,12 @@ main()
 {
     try
     {
-        FrameBuffer8880 fb{"/dev/dri/card0"};
+        // Draw into a shadow, as the pixels are read back.
+
+        FrameBuffer8880::Options options;
+        options.shadow = true;
+
+        FrameBuffer8880 fb{"/dev/dri/card0", options};
         fb.clear();
 
         //-----------------------------------------------------------------
@@ -124,6 +129,9 @@ main()
 
         fb.putImage(textLocation, textImage);
 
+        fb.addDamage();
+        fb.present();
+
         //-----------------------------------------------------------------
 
         sleep(10);
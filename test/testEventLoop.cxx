@@ -0,0 +1,94 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <system_error>
+
+#include "allocationCounter.h"
+#include "eventLoop.h"
+
+//-------------------------------------------------------------------------
+
+using namespace ogsfb32;
+
+//-------------------------------------------------------------------------
+
+// Runs a fast timer for a few hundred ticks and checks that, once it is
+// running, a tick does not allocate. A second timer removes itself from
+// its own callback, to check that this is safe.
+
+int
+main()
+{
+    try
+    {
+        constexpr int ticks = 200;
+
+        EventLoop loop;
+        AllocationCounter allocations;
+        int count = 0;
+
+        loop.addTimer(std::chrono::milliseconds(1), [&]
+        {
+            allocations.endFrame();
+
+            if (++count == ticks)
+            {
+                loop.stop();
+            }
+        });
+
+        int once = 0;
+        int onceTimer = -1;
+
+        onceTimer = loop.addTimer(std::chrono::milliseconds(1), [&]
+        {
+            ++once;
+            loop.removeTimer(onceTimer);
+        });
+
+        loop.run();
+
+        std::cout << allocations.getAllocatingFrames() << " of "
+                  << allocations.getFrames() << " ticks allocated, "
+                  << "self removing timer called " << once << " times\n";
+
+        if ((allocations.getAllocatingFrames() != 0) or (once != 1))
+        {
+            return EXIT_FAILURE;
+        }
+    }
+    catch (std::exception& error)
+    {
+        std::cerr << "Error: " << error.what() << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    return 0;
+}
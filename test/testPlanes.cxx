@@ -0,0 +1,134 @@
+//-------------------------------------------------------------------------
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2022 Andrew Duncan
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the
+// "Software"), to deal in the Software without restriction, including
+// without limitation the rights to use, copy, modify, merge, publish,
+// distribute, sublicense, and/or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to
+// the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+// SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//-------------------------------------------------------------------------
+
+
+#include <chrono>
+#include <iostream>
+#include <system_error>
+#include <thread>
+
+#include "framebuffer8880.h"
+#include "image8880.h"
+#include "image8880Font.h"
+#include "image8880Graphics.h"
+#include "planeManager.h"
+
+//-------------------------------------------------------------------------
+
+using namespace std::chrono_literals;
+using namespace ogsfb32;
+
+//-------------------------------------------------------------------------
+
+int
+main()
+{
+    try
+    {
+        FrameBuffer8880 fb{"/dev/dri/card0"};
+        fb.clear(RGB8880{0, 0, 63});
+
+        PlaneManager planes{fb};
+
+        std::cout << "free planes: " << planes.freePlanes() << "\n";
+
+        //-----------------------------------------------------------------
+
+        auto hud = planes.createOverlay(180, 40, 0);
+        hud->getImage().clear(RGB8880{63, 63, 63});
+        drawString(FontPoint{4, 12}, "overlay HUD", RGB8880{255, 255, 255}, hud->getImage());
+        hud->setPosition(FB8880Point{8, 8});
+        hud->update();
+        hud->show();
+
+        auto cursor = planes.createOverlay(32, 32, 1, true);
+        auto& cursorImage = cursor->getImage();
+        cursorImage.clear(Overlay::transparent);
+        line(cursorImage, Image8880Point(0, 0), Image8880Point(31, 31), RGB8880{255, 255, 0});
+        line(cursorImage, Image8880Point(0, 0), Image8880Point(31, 0), RGB8880{255, 255, 0});
+        line(cursorImage, Image8880Point(0, 0), Image8880Point(0, 31), RGB8880{255, 255, 0});
+        cursor->update();
+        cursor->show();
+
+        std::cout << "HUD: " << ((hud->isHardware()) ? "plane" : "software") << "\n";
+        std::cout << "cursor: " << ((cursor->isHardware()) ? "plane" : "software") << "\n";
+
+        //-----------------------------------------------------------------
+
+        // Bounce the cursor around the screen for ten seconds.
+
+        int32_t x = 0;
+        int32_t y = 0;
+        int32_t dx = 3;
+        int32_t dy = 2;
+
+        for (int frame = 0 ; frame < 600 ; ++frame)
+        {
+            x += dx;
+            y += dy;
+
+            if ((x < 0) or (x + 32 > fb.getWidth()))
+            {
+                dx = -dx;
+                x += 2 * dx;
+            }
+
+            if ((y < 0) or (y + 32 > fb.getHeight()))
+            {
+                dy = -dy;
+                y += 2 * dy;
+            }
+
+            cursor->setPosition(FB8880Point{x, y});
+
+            // With atomic modesetting the move is shown by a commit that
+            // completes at the next vertical blank.
+
+            if (fb.present() and fb.getAtomic())
+            {
+                fb.handleEvents();
+            }
+            else
+            {
+                std::this_thread::sleep_for(16ms);
+            }
+        }
+
+        cursor.reset();
+        hud.reset();
+
+        fb.clear();
+    }
+    catch (std::exception& error)
+    {
+        std::cerr << "Error: " << error.what() << "\n";
+        exit(EXIT_FAILURE);
+    }
+
+    return 0;
+}
+